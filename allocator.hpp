@@ -0,0 +1,302 @@
+#ifndef ALLOCATOR_HPP
+# define ALLOCATOR_HPP
+
+# include <cstddef>
+# include <cstdlib>
+# include <cstring>
+# include <new>
+# include <limits>
+# include <memory>
+# if __cplusplus >= 201103L
+#  include <utility>
+# endif
+# include <unistd.h>
+# include <sys/mman.h>
+# include "utils.hpp"
+
+/*
+** Blocks of at least this many bytes are served by anonymous mmap, smaller
+** ones by operator new.
+*/
+# ifndef FT_MMAP_THRESHOLD
+#  define FT_MMAP_THRESHOLD (128 * 1024)
+# endif
+
+/*
+** Alignment operator new/malloc guarantee (glibc: two pointers).
+*/
+# ifndef FT_DEFAULT_ALIGNMENT
+#  define FT_DEFAULT_ALIGNMENT (2 * sizeof(void*))
+# endif
+
+namespace ft
+{
+	/*
+	** Allocators whose construct/destroy are plain placement new and
+	** destructor calls, so trivially copyable elements may be moved with
+	** memmove/memcpy behind their back.
+	*/
+	template<class Alloc> struct					has_plain_construct : public integral_constant<bool, false> {};
+	template<class T> struct						has_plain_construct<std::allocator<T> > : public integral_constant<bool, true> {};
+
+	/*
+	** Alignment every non-empty block from Alloc is guaranteed to have.
+	*/
+	template<class Alloc> struct					allocator_alignment : public integral_constant<size_t, FT_DEFAULT_ALIGNMENT> {};
+
+	/*
+	** Allocators with a reallocate(p, old_n, new_n) member that may move the
+	** block's bytes themselves; vector uses it for trivially copyable types
+	** instead of allocate + copy + deallocate.
+	*/
+	template<class Alloc> struct					can_reallocate : public integral_constant<bool, false> {};
+
+	/*
+	** Allocator for very large buffers of trivially relocatable types. Large
+	** blocks are anonymous mappings, so reallocate grows them with
+	** mremap(MREMAP_MAYMOVE): the kernel moves page table entries instead of
+	** copying the data and the old and new blocks never coexist.
+	*/
+	template<class T> class							mmap_allocator
+	{
+		public:
+			/*MEMBER TYPES*/
+			typedef T				value_type;
+			typedef T*				pointer;
+			typedef const T*		const_pointer;
+			typedef T&				reference;
+			typedef const T&		const_reference;
+			typedef size_t			size_type;
+			typedef ptrdiff_t		difference_type;
+
+			template<class U> struct	rebind
+			{
+				typedef mmap_allocator<U>	other;
+			};
+
+		private:
+			static size_type	_page()
+			{
+				static size_type	page = static_cast<size_type>(::sysconf(_SC_PAGESIZE));
+				return (page);
+			}
+
+			/*mapped length of an n-element block, 0 if it lives on the heap*/
+			static size_type	_mapped(size_type n)
+			{
+				size_type	bytes = n * sizeof(value_type);
+				if (bytes < FT_MMAP_THRESHOLD)
+					return (0);
+				return ((bytes + _page() - 1) & ~(_page() - 1));
+			}
+
+			static pointer		_map(size_type len)
+			{
+				void*	p = ::mmap(NULL, len, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+				if (p == MAP_FAILED)
+					throw std::bad_alloc();
+				return (static_cast<pointer>(p));
+			}
+
+		public:
+			/*MEMBER FUNCTIONS*/
+			mmap_allocator() {}
+
+			template<class U>	mmap_allocator(const mmap_allocator<U>&) {}
+
+			pointer				address(reference x) const
+			{
+				return (&x);
+			}
+
+			const_pointer		address(const_reference x) const
+			{
+				return (&x);
+			}
+
+			pointer				allocate(size_type n, const void* = NULL)
+			{
+				if (n > max_size())
+					throw std::bad_alloc();
+				if (!n)
+					return (NULL);
+				if (size_type len = _mapped(n))
+					return (_map(len));
+				return (static_cast<pointer>(::operator new(n * sizeof(value_type))));
+			}
+
+			void				deallocate(pointer p, size_type n)
+			{
+				if (!p)
+					return ;
+				if (size_type len = _mapped(n))
+					::munmap(p, len);
+				else
+					::operator delete(p);
+			}
+
+			/*
+			** Resizes the block at p from old_n to new_n elements, keeping the
+			** bytes of the first min(old_n, new_n) of them. Only valid for
+			** trivially copyable T.
+			*/
+			pointer				reallocate(pointer p, size_type old_n, size_type new_n)
+			{
+				size_type	old_len = _mapped(old_n);
+				size_type	new_len = _mapped(new_n);
+				if (!p)
+					return (allocate(new_n));
+				if (new_n > max_size())
+					throw std::bad_alloc();
+				if (old_len && new_len)
+				{
+					if (old_len == new_len)
+						return (p);
+# ifdef MREMAP_MAYMOVE
+					void*	q = ::mremap(p, old_len, new_len, MREMAP_MAYMOVE);
+					if (q == MAP_FAILED)
+						throw std::bad_alloc();
+					return (static_cast<pointer>(q));
+# endif
+				}
+				pointer	q = allocate(new_n);
+				std::memcpy(static_cast<void*>(q), static_cast<const void*>(p), (old_n < new_n ? old_n : new_n) * sizeof(value_type));
+				deallocate(p, old_n);
+				return (q);
+			}
+
+			size_type			max_size() const
+			{
+				return (std::numeric_limits<size_type>::max() / sizeof(value_type));
+			}
+
+# if __cplusplus >= 201103L
+			template<class U, class... Args> void	construct(U* p, Args&&... args)
+			{
+				new (static_cast<void*>(p)) U(std::forward<Args>(args)...);
+			}
+# else
+			void				construct(pointer p, const_reference val)
+			{
+				new (static_cast<void*>(p)) value_type(val);
+			}
+# endif
+
+			void				destroy(pointer p)
+			{
+				p->~value_type();
+			}
+	};
+
+	template<class T> struct						can_reallocate<mmap_allocator<T> > : public integral_constant<bool, true> {};
+	template<class T> struct						has_plain_construct<mmap_allocator<T> > : public integral_constant<bool, true> {};
+
+	template<class T, class U> bool					operator==(const mmap_allocator<T>&, const mmap_allocator<U>&)
+	{
+		return (true);
+	}
+
+	template<class T, class U> bool					operator!=(const mmap_allocator<T>&, const mmap_allocator<U>&)
+	{
+		return (false);
+	}
+
+	/*
+	** Allocator returning blocks aligned on Align bytes (a power of two), so
+	** SIMD kernels can use aligned loads on the whole buffer without a
+	** peeling loop.
+	*/
+	template<class T, size_t Align = 64> class		aligned_allocator
+	{
+		public:
+			/*MEMBER TYPES*/
+			typedef T				value_type;
+			typedef T*				pointer;
+			typedef const T*		const_pointer;
+			typedef T&				reference;
+			typedef const T&		const_reference;
+			typedef size_t			size_type;
+			typedef ptrdiff_t		difference_type;
+
+			template<class U> struct	rebind
+			{
+				typedef aligned_allocator<U, Align>	other;
+			};
+
+			static const size_type	alignment = Align < sizeof(void*) ? sizeof(void*) : Align;
+
+		private:
+			/*posix_memalign only takes powers of two*/
+			typedef char			_align_check[sizeof(static_check<Align && !(Align & (Align - 1))>)];
+
+		public:
+			/*MEMBER FUNCTIONS*/
+			aligned_allocator() {}
+
+			template<class U>	aligned_allocator(const aligned_allocator<U, Align>&) {}
+
+			pointer				address(reference x) const
+			{
+				return (&x);
+			}
+
+			const_pointer		address(const_reference x) const
+			{
+				return (&x);
+			}
+
+			pointer				allocate(size_type n, const void* = NULL)
+			{
+				void*	p = NULL;
+				if (n > max_size())
+					throw std::bad_alloc();
+				if (::posix_memalign(&p, alignment, n ? n * sizeof(value_type) : 1) != 0)
+					throw std::bad_alloc();
+				return (static_cast<pointer>(p));
+			}
+
+			void				deallocate(pointer p, size_type)
+			{
+				std::free(p);
+			}
+
+			size_type			max_size() const
+			{
+				return (std::numeric_limits<size_type>::max() / sizeof(value_type));
+			}
+
+# if __cplusplus >= 201103L
+			template<class U, class... Args> void	construct(U* p, Args&&... args)
+			{
+				new (static_cast<void*>(p)) U(std::forward<Args>(args)...);
+			}
+# else
+			void				construct(pointer p, const_reference val)
+			{
+				new (static_cast<void*>(p)) value_type(val);
+			}
+# endif
+
+			void				destroy(pointer p)
+			{
+				p->~value_type();
+			}
+	};
+
+	template<class T, size_t Align> const typename aligned_allocator<T, Align>::size_type	aligned_allocator<T, Align>::alignment;
+
+	template<class T, size_t Align> struct			has_plain_construct<aligned_allocator<T, Align> > : public integral_constant<bool, true> {};
+	template<class T, size_t Align> struct			allocator_alignment<aligned_allocator<T, Align> > : public integral_constant<size_t, aligned_allocator<T, Align>::alignment> {};
+
+	template<class T, class U, size_t Align> bool	operator==(const aligned_allocator<T, Align>&, const aligned_allocator<U, Align>&)
+	{
+		return (true);
+	}
+
+	template<class T, class U, size_t Align> bool	operator!=(const aligned_allocator<T, Align>&, const aligned_allocator<U, Align>&)
+	{
+		return (false);
+	}
+}
+
+#endif
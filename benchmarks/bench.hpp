@@ -0,0 +1,67 @@
+#ifndef __BENCH_HPP_
+# define __BENCH_HPP_
+
+# include <iostream>
+# include <iomanip>
+# include <string>
+# include <sys/time.h>
+
+# include "../bitvector.hpp"
+# include "../concurrent_vector.hpp"
+# include "../interval_map.hpp"
+# include "../map.hpp"
+# include "../mmap_vector.hpp"
+# include "../parallel.hpp"
+# include "../small_vector.hpp"
+# include "../soa_vector.hpp"
+# include "../stack.hpp"
+# include "../utils.hpp"
+# include "../vector.hpp"
+
+# define RESET "\e[0m"
+# define BLUE "\e[94m"
+# define BOLD "\e[1m"
+
+void	bench_vector();
+void	bench_stack();
+void	bench_map();
+void	bench_par();
+
+void 	print_header(std::string str);
+
+inline double	now_ms()
+{
+	struct timeval	tv;
+
+	gettimeofday(&tv, NULL);
+	return (tv.tv_sec * 1000.0 + tv.tv_usec / 1000.0);
+}
+
+inline void		report(std::string name, double ms, double ops)
+{
+	std::string margin(name.length() < 40 ? 40 - name.length() : 1, ' ');
+	std::cout << name << ": " << margin << std::fixed << std::setprecision(1)
+		<< std::setw(9) << ms << " ms" << std::setw(14) << (ms * 1e6 / ops) << " ns/op" << std::endl;
+}
+
+/*
+** Keeps the optimizer from discarding a benchmarked result.
+*/
+template <typename T>
+inline void		sink(const T& v)
+{
+	__asm__ __volatile__("" : : "r"(&v) : "memory");
+}
+
+/*
+** Small deterministic PRNG so every run sees the same key sequence.
+*/
+inline unsigned long	next_rand(unsigned long& state)
+{
+	state ^= state << 13;
+	state ^= state >> 7;
+	state ^= state << 17;
+	return (state);
+}
+
+#endif
@@ -0,0 +1,95 @@
+#include "bench.hpp"
+
+/*
+** Same 200 byte payload, once forced inline and once stored out of line.
+*/
+struct	record_inline
+{
+	long	id;
+	char	payload[192];
+};
+
+struct	record_split
+{
+	long	id;
+	char	payload[192];
+};
+
+namespace ft
+{
+	template<> struct	map_split_values<record_inline> : public integral_constant<bool, false> {};
+	template<> struct	map_split_values<record_split> : public integral_constant<bool, true> {};
+}
+
+template <class Record>
+static void	bench_lookup(std::string name, size_t n)
+{
+	ft::map<long, Record>	m;
+	Record					rec;
+	unsigned long			state = 88172645463325252UL;
+	double					t;
+	long					sum = 0;
+
+	for (size_t i = 0; i < n; i++)
+	{
+		rec.id = i;
+		m.insert(ft::make_pair(static_cast<long>(next_rand(state) % (n * 4)), rec));
+	}
+	state = 88172645463325252UL;
+	t = now_ms();
+	for (size_t round = 0; round < 4; round++)
+	{
+		state = 88172645463325252UL;
+		for (size_t i = 0; i < n; i++)
+			sum += m.count(static_cast<long>(next_rand(state) % (n * 4)));
+	}
+	report(name, now_ms() - t, n * 4.0);
+	sink(sum);
+}
+
+static void	bench_interval(size_t n, size_t queries)
+{
+	ft::interval_map<long, long>	im;
+	ft::map<long, long>				m;
+	unsigned long					state = 2463534242UL;
+	double							t;
+	size_t							found = 0;
+
+	for (size_t i = 0; i < n; i++)
+	{
+		long	lo = next_rand(state) % 1000000000;
+		long	len = next_rand(state) % 10000;
+		im.insert(ft::make_pair(ft::make_pair(lo, lo + len), static_cast<long>(i)));
+		m.insert(ft::make_pair(lo, lo + len));
+	}
+
+	t = now_ms();
+	for (size_t q = 0; q < queries; q++)
+	{
+		ft::vector<ft::interval_map<long, long>::iterator>	out;
+		long	lo = next_rand(state) % 1000000000;
+		im.overlaps(lo, lo + 5000, out);
+		found += out.size();
+	}
+	report("interval_map overlaps, 1M intervals", now_ms() - t, queries);
+
+	size_t	scan_queries = queries / 1000;
+	t = now_ms();
+	for (size_t q = 0; q < scan_queries; q++)
+	{
+		long	lo = next_rand(state) % 1000000000;
+		for (ft::map<long, long>::iterator it = m.begin(); it != m.end() && it->first <= lo + 5000; ++it)
+			if (it->second >= lo)
+				found++;
+	}
+	report("map scan overlaps, 1M intervals", now_ms() - t, scan_queries);
+	sink(found);
+}
+
+void	bench_map()
+{
+	print_header("MAP");
+	bench_lookup<record_inline>("count 1M, 200B inline values", 1000000);
+	bench_lookup<record_split>("count 1M, 200B out-of-line values", 1000000);
+	bench_interval(1000000, 100000);
+}
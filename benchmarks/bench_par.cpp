@@ -0,0 +1,115 @@
+#include "bench.hpp"
+#include <algorithm>
+#include <cmath>
+#include <numeric>
+#include <sstream>
+
+struct	heavy
+{
+	void	operator()(double& x) const
+	{
+		x = std::sqrt(x * x + 1.0);
+	}
+};
+
+struct	scale
+{
+	double	operator()(double x) const
+	{
+		return (x * 0.5 + 1.0);
+	}
+};
+
+static void	fill(ft::vector<double>& v, size_t n)
+{
+	unsigned long	state = 88172645463325252UL;
+
+	v.clear();
+	for (size_t i = 0; i < n; i++)
+		v.push_back(static_cast<double>(next_rand(state) % 1000000));
+}
+
+static std::string	label(const std::string& name, size_t threads)
+{
+	std::ostringstream	os;
+
+	os << name << " x" << threads;
+	return (os.str());
+}
+
+/*
+** Every algorithm on the same 20M doubles, once per thread count.
+*/
+static void	bench_scaling(size_t n, size_t threads)
+{
+	ft::vector<double>	v;
+	ft::vector<double>	out(n);
+	double				t;
+
+	ft::par::set_threads(threads);
+	fill(v, n);
+	t = now_ms();
+	ft::par::for_each(v.begin(), v.end(), heavy());
+	report(label("par::for_each sqrt 20M", threads), now_ms() - t, n);
+	t = now_ms();
+	ft::par::transform(v.begin(), v.end(), out.begin(), scale());
+	report(label("par::transform 20M", threads), now_ms() - t, n);
+	t = now_ms();
+	sink(ft::par::reduce(v.begin(), v.end(), 0.0));
+	report(label("par::reduce 20M", threads), now_ms() - t, n);
+	t = now_ms();
+	ft::par::inclusive_scan(v.begin(), v.end(), out.begin());
+	report(label("par::inclusive_scan 20M", threads), now_ms() - t, n);
+	t = now_ms();
+	ft::par::sort(v.begin(), v.end());
+	report(label("par::sort 20M", threads), now_ms() - t, n);
+	fill(v, n);
+	t = now_ms();
+	ft::par::stable_sort(v.begin(), v.end());
+	report(label("par::stable_sort 20M", threads), now_ms() - t, n);
+	sink(out[n / 2]);
+}
+
+/*
+** Many short ranges, below the cutoff: they must cost what the serial loop
+** costs, without waking the pool.
+*/
+static void	bench_cutoff(size_t n, size_t rounds)
+{
+	ft::vector<double>	v;
+	double				t;
+	double				sum = 0;
+
+	fill(v, n);
+	t = now_ms();
+	for (size_t i = 0; i < rounds; i++)
+		sum += ft::par::reduce(v.begin(), v.end(), 0.0);
+	report("par::reduce 100k x 1000", now_ms() - t, n * rounds);
+	t = now_ms();
+	for (size_t i = 0; i < rounds; i++)
+		sum += std::accumulate(v.begin(), v.end(), 0.0);
+	report("std::accumulate 100k x 1000", now_ms() - t, n * rounds);
+	sink(sum);
+}
+
+void	bench_par()
+{
+	size_t	hardware = ft::par::hardware_threads();
+	size_t	n = 20000000;
+
+	print_header("PARALLEL");
+	for (size_t threads = 1; threads < hardware; threads *= 2)
+		bench_scaling(n, threads);
+	bench_scaling(n, hardware);
+	{
+		ft::vector<double>	v;
+		double				t;
+
+		fill(v, n);
+		t = now_ms();
+		std::sort(v.begin(), v.end());
+		report("std::sort 20M", now_ms() - t, n);
+	}
+	bench_cutoff(1000, 100000);
+	ft::par::set_threads(0);
+}
@@ -0,0 +1,66 @@
+#include "bench.hpp"
+#include <deque>
+#include <stack>
+
+/*
+** Depth oscillating across a block boundary: every other operation enters
+** or leaves a block. An empty ft::deque starts half way into its first
+** block, libstdc++'s at the start of a 128-int block.
+*/
+template<class Stack>
+static void	bench_oscillate(Stack& s, size_t depth, size_t n, const std::string& name)
+{
+	double	t;
+
+	for (size_t i = 0; i < depth; i++)
+		s.push(static_cast<int>(i));
+	t = now_ms();
+	for (size_t i = 0; i < n; i++)
+	{
+		s.push(static_cast<int>(i));
+		s.push(static_cast<int>(i));
+		s.pop();
+		s.pop();
+	}
+	sink(s.top());
+	report(name, now_ms() - t, n * 4);
+}
+
+template<class Stack>
+static void	bench_fill(Stack& s, size_t n, const std::string& name)
+{
+	double	t;
+	long	sum = 0;
+
+	t = now_ms();
+	for (size_t i = 0; i < n; i++)
+		s.push(static_cast<int>(i));
+	while (!s.empty())
+	{
+		sum += s.top();
+		s.pop();
+	}
+	sink(sum);
+	report(name, now_ms() - t, n * 2);
+}
+
+void	bench_stack()
+{
+	print_header("STACK");
+	{
+		ft::stack<int>	s;
+		bench_oscillate(s, ft::deque<int>::block_size / 2 - 1, 50000000, "ft::stack oscillate 50M");
+	}
+	{
+		std::stack<int>	s;
+		bench_oscillate(s, 127, 50000000, "std::stack oscillate 50M");
+	}
+	{
+		ft::stack<int>	s;
+		bench_fill(s, 50000000, "ft::stack push/pop 50M");
+	}
+	{
+		std::stack<int>	s;
+		bench_fill(s, 50000000, "std::stack push/pop 50M");
+	}
+}
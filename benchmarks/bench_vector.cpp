@@ -0,0 +1,544 @@
+#include "bench.hpp"
+#include <algorithm>
+#include <cstdio>
+#include <sstream>
+#include <vector>
+
+static void	bench_push_back(size_t n)
+{
+	double	t;
+
+	t = now_ms();
+	{
+		ft::vector<int>	v;
+		for (size_t i = 0; i < n; i++)
+			v.push_back(static_cast<int>(i));
+		sink(v[n / 2]);
+	}
+	report("ft::vector push_back 100M int", now_ms() - t, n);
+
+	t = now_ms();
+	{
+		std::vector<int>	v;
+		for (size_t i = 0; i < n; i++)
+			v.push_back(static_cast<int>(i));
+		sink(v[n / 2]);
+	}
+	report("std::vector push_back 100M int", now_ms() - t, n);
+}
+
+/*
+** Best of a few rounds, so both containers run on already faulted-in pages.
+*/
+static void	bench_fill_insert(size_t n)
+{
+	double	best_ft = 1e30;
+	double	best_std = 1e30;
+	double	t;
+
+	for (int round = 0; round < 5; round++)
+	{
+		{
+			std::vector<int>	v(n, 1);
+			t = now_ms();
+			v.insert(v.begin() + n / 2, n, 7);
+			t = now_ms() - t;
+			best_std = t < best_std ? t : best_std;
+			sink(v[n]);
+		}
+		{
+			ft::vector<int>	v(n, 1);
+			t = now_ms();
+			v.insert(v.begin() + n / 2, n, 7);
+			t = now_ms() - t;
+			best_ft = t < best_ft ? t : best_ft;
+			sink(v[n]);
+		}
+	}
+	report("ft::vector insert 1M copies mid 1M", best_ft, n);
+	report("std::vector insert 1M copies mid 1M", best_std, n);
+}
+
+/*
+** Many short-lived 6-element sequences: one malloc/free each for ft::vector,
+** none for small_vector.
+*/
+static void	bench_short(size_t n)
+{
+	double	t;
+	long	sum = 0;
+
+	t = now_ms();
+	for (size_t i = 0; i < n; i++)
+	{
+		ft::vector<int>	v;
+		for (int j = 0; j < 6; j++)
+			v.push_back(j + static_cast<int>(i));
+		sum += v.back();
+		sink(v);
+	}
+	report("ft::vector 10M short push_back x6", now_ms() - t, n);
+
+	t = now_ms();
+	for (size_t i = 0; i < n; i++)
+	{
+		ft::small_vector<int, 8>	v;
+		for (int j = 0; j < 6; j++)
+			v.push_back(j + static_cast<int>(i));
+		sum += v.back();
+		sink(v);
+	}
+	report("ft::small_vector 10M short push_back x6", now_ms() - t, n);
+	sink(sum);
+}
+
+/*
+** Growing a 400 MB buffer: copy on every doubling vs mremap.
+*/
+static void	bench_grow_large(size_t n)
+{
+	double	t;
+
+	t = now_ms();
+	{
+		ft::vector<unsigned long>	v;
+		for (size_t i = 0; i < n; i++)
+			v.push_back(i);
+		sink(v[n / 2]);
+	}
+	report("ft::vector push_back 50M ulong", now_ms() - t, n);
+
+	t = now_ms();
+	{
+		ft::vector<unsigned long, ft::mmap_allocator<unsigned long> >	v;
+		for (size_t i = 0; i < n; i++)
+			v.push_back(i);
+		sink(v[n / 2]);
+	}
+	report("ft::vector<mmap_allocator> push_back 50M ulong", now_ms() - t, n);
+}
+
+/*
+** Two equal 256 MB buffers that only differ in their last element.
+*/
+template<class T>
+static void	bench_compare_type(size_t n, const std::string& name)
+{
+	double	t;
+
+	{
+		ft::vector<T>	a(n, T(1));
+		ft::vector<T>	b(n, T(1));
+		b.back() = T(2);
+		t = now_ms();
+		sink(a == b);
+		report("ft::vector<" + name + "> == 256MB", now_ms() - t, n);
+		t = now_ms();
+		sink(a < b);
+		report("ft::vector<" + name + "> < 256MB", now_ms() - t, n);
+	}
+	{
+		std::vector<T>	a(n, T(1));
+		std::vector<T>	b(n, T(1));
+		b.back() = T(2);
+		t = now_ms();
+		sink(a == b);
+		report("std::vector<" + name + "> == 256MB", now_ms() - t, n);
+		t = now_ms();
+		sink(a < b);
+		report("std::vector<" + name + "> < 256MB", now_ms() - t, n);
+	}
+}
+
+static void	bench_compare()
+{
+	bench_compare_type<unsigned char>(256u << 20, "uchar");
+	bench_compare_type<int>(64u << 20, "int");
+	bench_compare_type<double>(32u << 20, "double");
+}
+
+/*
+** Sizing a 1 GB byte buffer that is about to be overwritten.
+*/
+static void	bench_resize(size_t n)
+{
+	double	t;
+
+	t = now_ms();
+	{
+		ft::vector<char>	v;
+		v.resize(n);
+		sink(v[n / 2]);
+	}
+	report("ft::vector<char> resize 1GB", now_ms() - t, n);
+
+	t = now_ms();
+	{
+		ft::vector<char>	v;
+		v.resize_default_init(n);
+		sink(v.size());
+	}
+	report("ft::vector<char> resize_default_init 1GB", now_ms() - t, n);
+}
+
+/*
+** Reassigning a scratch vector of 64 strings from a same-sized source.
+*/
+static void	bench_reassign(size_t n)
+{
+	double	t;
+
+	{
+		ft::vector<std::string>	src(64, std::string(40, 's'));
+		ft::vector<std::string>	scratch;
+		t = now_ms();
+		for (size_t i = 0; i < n; i++)
+		{
+			scratch = src;
+			sink(scratch[i & 63]);
+		}
+		report("ft::vector<string> reassign 1M x64", now_ms() - t, n);
+	}
+	{
+		std::vector<std::string>	src(64, std::string(40, 's'));
+		std::vector<std::string>	scratch;
+		t = now_ms();
+		for (size_t i = 0; i < n; i++)
+		{
+			scratch = src;
+			sink(scratch[i & 63]);
+		}
+		report("std::vector<string> reassign 1M x64", now_ms() - t, n);
+	}
+}
+
+/*
+** 64-byte records scanned on a single field: the array of structs streams
+** every byte of every record, the soa_vector only the price column.
+*/
+struct	record_name
+{
+	char	text[52];
+};
+
+struct	record
+{
+	double		price;
+	int			quantity;
+	record_name	name;
+};
+
+static void	bench_columns(size_t n)
+{
+	ft::vector<record>								rows;
+	ft::soa_vector<double, int, record_name>		cols;
+	record											r;
+	double											t;
+	double											sum;
+
+	std::memset(&r, 0, sizeof(r));
+	for (size_t i = 0; i < n; i++)
+	{
+		r.price = static_cast<double>(i % 1000);
+		r.quantity = static_cast<int>(i);
+		rows.push_back(r);
+		cols.push_back(r.price, r.quantity, r.name);
+	}
+	t = now_ms();
+	sum = 0;
+	for (size_t i = 0; i < rows.size(); i++)
+		sum += rows[i].price;
+	sink(sum);
+	report("ft::vector<record> sum price 8M", now_ms() - t, n);
+	t = now_ms();
+	sum = 0;
+	ft::soa_span<const double>	price = cols.column<0>();
+	for (const double* it = price.begin(); it != price.end(); ++it)
+		sum += *it;
+	sink(sum);
+	report("soa_vector sum price 8M", now_ms() - t, n);
+}
+
+/*
+** 256M flags, one set in 17: one byte each in ft::vector<bool>, one bit
+** each in bitvector.
+*/
+static void	bench_bits(size_t n)
+{
+	double	t;
+	size_t	c;
+
+	{
+		ft::vector<bool>	flags;
+		ft::vector<bool>	mask(n, true);
+
+		t = now_ms();
+		for (size_t i = 0; i < n; i++)
+			flags.push_back(i % 17 == 0);
+		report("ft::vector<bool> push_back 256M", now_ms() - t, n);
+		t = now_ms();
+		c = 0;
+		for (size_t i = 0; i < n; i++)
+			c += flags[i];
+		sink(c);
+		report("ft::vector<bool> count 256M", now_ms() - t, n);
+		t = now_ms();
+		for (size_t i = 0; i < n; i++)
+			mask[i] = mask[i] && flags[i];
+		sink(mask[n / 2]);
+		report("ft::vector<bool> and 256M", now_ms() - t, n);
+		t = now_ms();
+		c = 0;
+		for (size_t i = 0; i < n; i++)
+			if (flags[i])
+				c += i;
+		sink(c);
+		report("ft::vector<bool> scan set 256M", now_ms() - t, n);
+		std::cout << "ft::vector<bool> memory: " << flags.memory_usage() / (1 << 20) << " MiB" << std::endl;
+	}
+	{
+		ft::bitvector<>	flags;
+		ft::bitvector<>	mask(n, true);
+
+		t = now_ms();
+		for (size_t i = 0; i < n; i++)
+			flags.push_back(i % 17 == 0);
+		report("bitvector push_back 256M", now_ms() - t, n);
+		t = now_ms();
+		sink(flags.count());
+		report("bitvector count 256M", now_ms() - t, n);
+		t = now_ms();
+		mask &= flags;
+		sink(mask[n / 2]);
+		report("bitvector and 256M", now_ms() - t, n);
+		t = now_ms();
+		c = 0;
+		for (size_t i = flags.find_first(); i != flags.npos; i = flags.find_next(i))
+			c += i;
+		sink(c);
+		report("bitvector scan set 256M", now_ms() - t, n);
+		std::cout << "bitvector memory: " << flags.memory_usage() / (1 << 20) << " MiB" << std::endl;
+	}
+}
+
+/*
+** Whole-range scans that miss, so every element is read: ft::find, count
+** and minmax_element against the std algorithms, over ints and chars.
+*/
+template<class T> static void	bench_search_type(size_t n, size_t rounds, const std::string& name)
+{
+	ft::vector<T>	v;
+	unsigned long	state = 88172645463325252UL;
+	T				miss = static_cast<T>(127);
+	double			t;
+	size_t			c = 0;
+
+	for (size_t i = 0; i < n; i++)
+		v.push_back(static_cast<T>(next_rand(state) % 100));
+	t = now_ms();
+	for (size_t r = 0; r < rounds; r++)
+		c += std::find(v.begin(), v.end(), miss) - v.begin();
+	report("std::find " + name, now_ms() - t, n * rounds);
+	t = now_ms();
+	for (size_t r = 0; r < rounds; r++)
+		c += ft::find(v.begin(), v.end(), miss) - v.begin();
+	report("ft::find " + name, now_ms() - t, n * rounds);
+	t = now_ms();
+	for (size_t r = 0; r < rounds; r++)
+		c += std::count(v.begin(), v.end(), static_cast<T>(r % 100));
+	report("std::count " + name, now_ms() - t, n * rounds);
+	t = now_ms();
+	for (size_t r = 0; r < rounds; r++)
+		c += ft::count(v.begin(), v.end(), static_cast<T>(r % 100));
+	report("ft::count " + name, now_ms() - t, n * rounds);
+	t = now_ms();
+	for (size_t r = 0; r < rounds; r++)
+		c += *std::min_element(v.begin(), v.end()) + *std::max_element(v.begin(), v.end());
+	report("std::min+max_element " + name, now_ms() - t, n * rounds);
+	t = now_ms();
+	for (size_t r = 0; r < rounds; r++)
+	{
+		ft::pair<typename ft::vector<T>::iterator, typename ft::vector<T>::iterator>	m = ft::minmax_element(v.begin(), v.end());
+		c += *m.first + *m.second;
+	}
+	report("ft::minmax_element " + name, now_ms() - t, n * rounds);
+	sink(c);
+}
+
+static void	bench_search()
+{
+	bench_search_type<int>(1u << 22, 50, "int 4M x50");
+	bench_search_type<char>(1u << 24, 50, "char 16M x50");
+}
+
+/*
+** Persisting 50M longs and loading them back: ft::vector with stdio
+** read/write loops against a file-backed mmap_vector.
+*/
+static void	bench_file(size_t n)
+{
+	const char*	path = "/tmp/ft_bench.vec";
+	double		t;
+	long		sum;
+
+	t = now_ms();
+	{
+		ft::vector<long>	v;
+		std::FILE*			f = std::fopen(path, "wb");
+		for (size_t i = 0; i < n; i++)
+			v.push_back(static_cast<long>(i));
+		if (f)
+		{
+			sink(std::fwrite(&v[0], sizeof(long), v.size(), f));
+			std::fclose(f);
+		}
+	}
+	report("ft::vector fill + fwrite 50M", now_ms() - t, n);
+	t = now_ms();
+	{
+		ft::vector<long>	v(n);
+		std::FILE*			f = std::fopen(path, "rb");
+		if (f)
+		{
+			sink(std::fread(&v[0], sizeof(long), n, f));
+			std::fclose(f);
+		}
+		sum = 0;
+		for (size_t i = 0; i < n; i++)
+			sum += v[i];
+		sink(sum);
+	}
+	report("ft::vector fread + sum 50M", now_ms() - t, n);
+	std::remove(path);
+
+	t = now_ms();
+	{
+		ft::mmap_vector<long>	v(path, ft::mmap_vector<long>::ACCESS_SEQUENTIAL);
+		for (size_t i = 0; i < n; i++)
+			v.push_back(static_cast<long>(i));
+	}
+	report("mmap_vector fill + close 50M", now_ms() - t, n);
+	t = now_ms();
+	{
+		ft::mmap_vector<long>	v(path, ft::mmap_vector<long>::ACCESS_SEQUENTIAL);
+		sum = 0;
+		for (size_t i = 0; i < v.size(); i++)
+			sum += v[i];
+		sink(sum);
+	}
+	report("mmap_vector open + sum 50M", now_ms() - t, n);
+	std::remove(path);
+}
+
+/*one shared event log, appended to by every producer thread*/
+struct	event
+{
+	long	time;
+	long	source;
+	long	a;
+	long	b;
+};
+
+struct	log_job
+{
+	ft::vector<event>*				locked;
+	pthread_mutex_t*				lock;
+	ft::concurrent_vector<event>*	shared;
+	size_t							n;
+	bool							timed;
+	double							worst;
+};
+
+/*appends job->n events; a timed job keeps its longest append*/
+static void*	log_producer(void* arg)
+{
+	log_job*	job = static_cast<log_job*>(arg);
+	event		e = {0, 0, 0, 0};
+
+	for (size_t i = 0; i < job->n; i++)
+	{
+		double	t = job->timed ? now_ms() : 0;
+		e.time = static_cast<long>(i);
+		if (job->shared)
+			job->shared->push_back(e);
+		else
+		{
+			pthread_mutex_lock(job->lock);
+			job->locked->push_back(e);
+			pthread_mutex_unlock(job->lock);
+		}
+		if (job->timed)
+		{
+			t = now_ms() - t;
+			job->worst = t > job->worst ? t : job->worst;
+		}
+	}
+	return (NULL);
+}
+
+static double	log_run(size_t n, size_t threads, bool concurrent, bool timed)
+{
+	ft::vector<event>				locked;
+	ft::concurrent_vector<event>	shared;
+	pthread_mutex_t					lock;
+	ft::vector<pthread_t>			ids(threads);
+	ft::vector<log_job>				jobs(threads);
+	double							t;
+	double							worst = 0;
+
+	pthread_mutex_init(&lock, NULL);
+	for (size_t i = 0; i < threads; i++)
+	{
+		log_job	job = {&locked, &lock, concurrent ? &shared : NULL, n / threads, timed, 0};
+		jobs[i] = job;
+	}
+	t = now_ms();
+	for (size_t i = 0; i < threads; i++)
+		pthread_create(&ids[i], NULL, &log_producer, &jobs[i]);
+	for (size_t i = 0; i < threads; i++)
+	{
+		pthread_join(ids[i], NULL);
+		worst = jobs[i].worst > worst ? jobs[i].worst : worst;
+	}
+	t = now_ms() - t;
+	pthread_mutex_destroy(&lock);
+	return (timed ? worst : t);
+}
+
+/*
+** 16M events of 32 bytes appended by 1 to 8 producers: ft::vector behind
+** a mutex, reallocating under it, against a concurrent_vector. A second
+** run times every append to find the longest stall.
+*/
+static void	bench_concurrent(size_t n)
+{
+	const char*	names[2] = {"mutex + ft::vector 16M", "concurrent_vector 16M"};
+
+	for (size_t threads = 1; threads <= 8; threads *= 2)
+	{
+		for (int c = 0; c < 2; c++)
+		{
+			std::ostringstream	label;
+			label << names[c] << " x" << threads;
+			report(label.str(), log_run(n, threads, c, false), n);
+			std::cout << label.str() << " worst push_back: " << std::setprecision(3) << log_run(n, threads, c, true) << " ms" << std::endl;
+		}
+	}
+}
+
+void	bench_vector()
+{
+	print_header("VECTOR");
+	bench_push_back(100000000);
+	bench_fill_insert(1000000);
+	bench_short(10000000);
+	bench_grow_large(50000000);
+	bench_compare();
+	bench_resize(1u << 30);
+	bench_reassign(1000000);
+	bench_columns(8000000);
+	bench_search();
+	bench_bits(1u << 28);
+	bench_file(50000000);
+	bench_concurrent(1u << 24);
+}
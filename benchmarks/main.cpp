@@ -0,0 +1,57 @@
+#include "bench.hpp"
+
+void 	print_header(std::string str)
+{
+	int margin = (40 - str.length()) / 2;
+	int width = (margin * 2 + str.length()) + 2;
+
+	std::cout << BOLD << BLUE << std::endl;
+	std::cout << std::string(width, '*') << std::endl;
+	std::cout << '*' << RESET << std::string(margin, ' ') << str << std::string(margin, ' ') << BOLD << BLUE << '*' << std::endl;
+	std::cout << std::string(width, '*') << std::endl;
+	std::cout << RESET << std::endl;
+}
+
+void print_error()
+{
+	std::cout << "Pass the name of the benchmark in argument."  << std::endl;
+	std::cout << "List of valid args : "  << std::endl;
+	std::cout << "- stack"  << std::endl;
+	std::cout << "- vector"  << std::endl;
+	std::cout << "- map"  << std::endl;
+	std::cout << "- par"  << std::endl;
+	std::cout << "- all"  << std::endl;
+}
+
+int main(int argc, char **argv)
+{
+	std::string test;
+
+	if (argc < 2)
+	{
+		print_error();
+		return (1);
+	}
+	test = argv[1];
+	if (test == "all")
+	{
+		bench_stack();
+		bench_vector();
+		bench_map();
+		bench_par();
+	}
+	else if (test == "stack")
+		bench_stack();
+	else if (test == "vector")
+		bench_vector();
+	else if (test == "map")
+		bench_map();
+	else if (test == "par")
+		bench_par();
+	else
+	{
+		print_error();
+		return (1);
+	}
+	return (0);
+}
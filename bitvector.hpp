@@ -0,0 +1,708 @@
+#ifndef BITVECTOR_HPP
+# define BITVECTOR_HPP
+
+# include <climits>
+# include <memory>
+# include <iterator>
+# include <stdexcept>
+# include "utils.hpp"
+# include "vector.hpp"
+
+namespace ft
+{
+	/*
+	** Set bits of a word. Without the popcnt instruction, GCC lowers
+	** __builtin_popcountl to a libgcc call; the SWAR sum is inline and
+	** vectorizes in a loop.
+	*/
+	inline unsigned						popcount_word(unsigned long x)
+	{
+# if defined(__POPCNT__)
+		return (__builtin_popcountl(x));
+# else
+		if (sizeof(x) != 8)
+			return (__builtin_popcountl(x));
+		x = x - ((x >> 1) & 0x5555555555555555UL);
+		x = (x & 0x3333333333333333UL) + ((x >> 2) & 0x3333333333333333UL);
+		x = (x + (x >> 4)) & 0x0f0f0f0f0f0f0f0fUL;
+		return (static_cast<unsigned>((x * 0x0101010101010101UL) >> 56));
+# endif
+	}
+
+	/*****************/
+	/* BIT REFERENCE */
+	/*****************/
+
+	/*
+	** Proxy for one bit: the word holding it and its mask. W is const for
+	** the const_iterator's references, which can only be read.
+	*/
+	template<class W> class								bit_reference
+	{
+		private:
+			/*variables*/
+			W*										_word;
+			typename remove_const<W>::type			_mask;
+
+		public:
+			/*MEMBER FUNCTIONS*/
+			bit_reference(W* word, typename remove_const<W>::type mask) :
+				_word(word),
+				_mask(mask)
+			{}
+
+			operator bool() const
+			{
+				return ((*_word & _mask) != 0);
+			}
+
+			bool			operator~() const
+			{
+				return (!(*_word & _mask));
+			}
+
+			bit_reference&	operator=(bool x)
+			{
+				if (x)
+					*_word |= _mask;
+				else
+					*_word &= ~_mask;
+				return (*this);
+			}
+
+			bit_reference&	operator=(const bit_reference& x)
+			{
+				return (*this = static_cast<bool>(x));
+			}
+
+			void			flip()
+			{
+				*_word ^= _mask;
+			}
+	};
+
+	/****************/
+	/* BIT ITERATOR */
+	/****************/
+
+	template<class W> class								bit_iterator : public std::iterator<std::random_access_iterator_tag, bool>
+	{
+		public:
+			/*MEMBER TYPES*/
+			typedef std::random_access_iterator_tag	iterator_category;
+			typedef bool							value_type;
+			typedef ptrdiff_t						difference_type;
+			typedef void							pointer;
+			typedef bit_reference<W>				reference;
+
+			static const size_t		bits = sizeof(W) * CHAR_BIT;
+
+		private:
+			/*variables*/
+			W*		_words;
+			size_t	_pos;
+
+		public:
+			/*MEMBER FUNCTIONS*/
+			bit_iterator() :
+				_words(NULL),
+				_pos(0)
+			{}
+
+			bit_iterator(W* words, size_t pos) :
+				_words(words),
+				_pos(pos)
+			{}
+
+			W*						words() const
+			{
+				return (_words);
+			}
+
+			size_t					pos() const
+			{
+				return (_pos);
+			}
+
+			reference				operator*() const
+			{
+				return (reference(_words + _pos / bits, static_cast<typename remove_const<W>::type>(1) << (_pos % bits)));
+			}
+
+			reference				operator[](difference_type n) const
+			{
+				return (*(*this + n));
+			}
+
+			bit_iterator&			operator++()
+			{
+				_pos++;
+				return (*this);
+			}
+
+			bit_iterator			operator++(int)
+			{
+				bit_iterator	t(*this);
+				_pos++;
+				return (t);
+			}
+
+			bit_iterator&			operator--()
+			{
+				_pos--;
+				return (*this);
+			}
+
+			bit_iterator			operator--(int)
+			{
+				bit_iterator	t(*this);
+				_pos--;
+				return (t);
+			}
+
+			bit_iterator&			operator+=(difference_type n)
+			{
+				_pos += n;
+				return (*this);
+			}
+
+			bit_iterator&			operator-=(difference_type n)
+			{
+				_pos -= n;
+				return (*this);
+			}
+
+			bit_iterator			operator+(difference_type n) const
+			{
+				return (bit_iterator(_words, _pos + n));
+			}
+
+			bit_iterator			operator-(difference_type n) const
+			{
+				return (bit_iterator(_words, _pos - n));
+			}
+
+			operator bit_iterator<const W>() const
+			{
+				return (bit_iterator<const W>(_words, _pos));
+			}
+	};
+	/*NON-MEMBER FUNCTION OVERLOADS*/
+	template<class W_lhs, class W_rhs> bool								operator==(const bit_iterator<W_lhs>& lhs, const bit_iterator<W_rhs>& rhs)
+	{
+		return (lhs.pos() == rhs.pos());
+	}
+
+	template<class W_lhs, class W_rhs> bool								operator!=(const bit_iterator<W_lhs>& lhs, const bit_iterator<W_rhs>& rhs)
+	{
+		return (lhs.pos() != rhs.pos());
+	}
+
+	template<class W_lhs, class W_rhs> bool								operator<(const bit_iterator<W_lhs>& lhs, const bit_iterator<W_rhs>& rhs)
+	{
+		return (lhs.pos() < rhs.pos());
+	}
+
+	template<class W_lhs, class W_rhs> bool								operator<=(const bit_iterator<W_lhs>& lhs, const bit_iterator<W_rhs>& rhs)
+	{
+		return (lhs.pos() <= rhs.pos());
+	}
+
+	template<class W_lhs, class W_rhs> bool								operator>(const bit_iterator<W_lhs>& lhs, const bit_iterator<W_rhs>& rhs)
+	{
+		return (lhs.pos() > rhs.pos());
+	}
+
+	template<class W_lhs, class W_rhs> bool								operator>=(const bit_iterator<W_lhs>& lhs, const bit_iterator<W_rhs>& rhs)
+	{
+		return (lhs.pos() >= rhs.pos());
+	}
+
+	template<class W> bit_iterator<W>									operator+(typename bit_iterator<W>::difference_type n, const bit_iterator<W>& it)
+	{
+		return (it + n);
+	}
+
+	template<class W_lhs, class W_rhs> typename bit_iterator<W_lhs>::difference_type	operator-(const bit_iterator<W_lhs>& lhs, const bit_iterator<W_rhs>& rhs)
+	{
+		return (static_cast<typename bit_iterator<W_lhs>::difference_type>(lhs.pos() - rhs.pos()));
+	}
+
+	/*************/
+	/* BITVECTOR */
+	/*************/
+
+	/*
+	** Sequence of bools packed 64 to a word, in an ft::vector of words.
+	** Bits past size() in the last word are always zero, so count, find and
+	** comparisons run over whole words without masking. The bulk operations
+	** are plain word loops the compiler vectorizes.
+	*/
+	template<class Alloc = std::allocator<unsigned long> > class	bitvector
+	{
+		public:
+			/*MEMBER TYPES*/
+			typedef bool												value_type;
+			typedef unsigned long										word_type;
+			typedef typename Alloc::template rebind<word_type>::other	allocator_type;
+			typedef bit_reference<word_type>							reference;
+			typedef bool												const_reference;
+			typedef bit_iterator<word_type>								iterator;
+			typedef bit_iterator<const word_type>						const_iterator;
+			typedef ft::reverse_iterator<iterator>						reverse_iterator;
+			typedef ft::reverse_iterator<const_iterator>				const_reverse_iterator;
+			typedef ptrdiff_t											difference_type;
+			typedef size_t												size_type;
+
+			static const size_type	bits_per_word = sizeof(word_type) * CHAR_BIT;
+			/*returned by find_first/find_next when no bit is set*/
+			static const size_type	npos = static_cast<size_type>(-1);
+
+		private:
+			/*variables*/
+			ft::vector<word_type, allocator_type>	_words;
+			size_type								_size;
+
+			/*functions*/
+			static size_type	_word_count(size_type n)
+			{
+				return ((n + bits_per_word - 1) / bits_per_word);
+			}
+
+			static word_type	_bit(size_type n)
+			{
+				return (static_cast<word_type>(1) << (n % bits_per_word));
+			}
+
+			/*clears the bits of the last word past size()*/
+			void				_trim()
+			{
+				if (_size % bits_per_word)
+					_words.back() &= _bit(_size) - 1;
+			}
+
+			void				_check_size(const bitvector& x) const
+			{
+				if (x._size != _size)
+					throw std::length_error("L");
+			}
+
+			/*first set bit at or after n*/
+			size_type			_find_from(size_type n) const
+			{
+				size_type	w = n / bits_per_word;
+				size_type	count = _words.size();
+				word_type	word;
+
+				if (n >= _size)
+					return (npos);
+				word = _words[w] & ~(_bit(n) - 1);
+				while (!word)
+				{
+					if (++w == count)
+						return (npos);
+					word = _words[w];
+				}
+				return (w * bits_per_word + __builtin_ctzl(word));
+			}
+
+		public:
+			/*MEMBER FUNCTIONS*/
+			explicit bitvector(const allocator_type& alloc = allocator_type()) :
+				_words(alloc),
+				_size(0)
+			{}
+
+			explicit bitvector(size_type n, bool val = false, const allocator_type& alloc = allocator_type()) :
+				_words(_word_count(n), val ? ~static_cast<word_type>(0) : 0, alloc),
+				_size(n)
+			{
+				_trim();
+			}
+
+			/*iterators*/
+			iterator				begin()
+			{
+				return (iterator(data(), 0));
+			}
+
+			const_iterator			begin() const
+			{
+				return (const_iterator(data(), 0));
+			}
+
+			iterator				end()
+			{
+				return (iterator(data(), _size));
+			}
+
+			const_iterator			end() const
+			{
+				return (const_iterator(data(), _size));
+			}
+
+			reverse_iterator		rbegin()
+			{
+				return (reverse_iterator(end()));
+			}
+
+			const_reverse_iterator	rbegin() const
+			{
+				return (const_reverse_iterator(end()));
+			}
+
+			reverse_iterator		rend()
+			{
+				return (reverse_iterator(begin()));
+			}
+
+			const_reverse_iterator	rend() const
+			{
+				return (const_reverse_iterator(begin()));
+			}
+
+			/*capacity*/
+			size_type				size() const
+			{
+				return (_size);
+			}
+
+			size_type				max_size() const
+			{
+				return (_words.max_size() < npos / bits_per_word ? _words.max_size() * bits_per_word : npos - 1);
+			}
+
+			bool					empty() const
+			{
+				return (!_size);
+			}
+
+			size_type				capacity() const
+			{
+				return (_words.capacity() * bits_per_word);
+			}
+
+			void					reserve(size_type n)
+			{
+				_words.reserve(_word_count(n));
+			}
+
+			void					resize(size_type n, bool val = false)
+			{
+				size_type	old = _size;
+
+				_words.resize(_word_count(n), val ? ~static_cast<word_type>(0) : 0);
+				if (val && n > old && old % bits_per_word)
+					_words[old / bits_per_word] |= ~(_bit(old) - 1);
+				_size = n;
+				_trim();
+			}
+
+			void					shrink_to_fit()
+			{
+				_words.shrink_to_fit();
+			}
+
+			/*bytes held by the bitvector itself: the object plus its whole buffer*/
+			size_type				memory_usage() const
+			{
+				return (sizeof(*this) - sizeof(_words) + _words.memory_usage());
+			}
+
+			size_type				wasted_bytes() const
+			{
+				return (_words.wasted_bytes());
+			}
+
+			/*element access*/
+			reference				operator[](size_type n)
+			{
+				return (reference(&_words[n / bits_per_word], _bit(n)));
+			}
+
+			const_reference			operator[](size_type n) const
+			{
+				return ((_words[n / bits_per_word] & _bit(n)) != 0);
+			}
+
+			reference				at(size_type n)
+			{
+				if (n >= _size)
+					throw std::out_of_range("OOB");
+				return ((*this)[n]);
+			}
+
+			const_reference			at(size_type n) const
+			{
+				if (n >= _size)
+					throw std::out_of_range("OOB");
+				return ((*this)[n]);
+			}
+
+			reference				front()
+			{
+				return ((*this)[0]);
+			}
+
+			const_reference			front() const
+			{
+				return ((*this)[0]);
+			}
+
+			reference				back()
+			{
+				return ((*this)[_size - 1]);
+			}
+
+			const_reference			back() const
+			{
+				return ((*this)[_size - 1]);
+			}
+
+			/*words holding the bits, bit n at word n / 64, bit n % 64*/
+			word_type*				data()
+			{
+				return (_words.empty() ? NULL : &_words[0]);
+			}
+
+			const word_type*		data() const
+			{
+				return (_words.empty() ? NULL : &_words[0]);
+			}
+
+			size_type				num_words() const
+			{
+				return (_words.size());
+			}
+
+			/*modifiers*/
+			void					assign(size_type n, bool val)
+			{
+				clear();
+				resize(n, val);
+			}
+
+			void					push_back(bool val)
+			{
+				if (_size % bits_per_word == 0)
+					_words.push_back(0);
+				if (val)
+					_words.back() |= _bit(_size);
+				_size++;
+			}
+
+			void					pop_back()
+			{
+				_size--;
+				if (_size % bits_per_word == 0)
+					_words.pop_back();
+				else
+					_words.back() &= ~_bit(_size);
+			}
+
+			void					swap(bitvector& x)
+			{
+				size_type	s = x._size;
+
+				_words.swap(x._words);
+				x._size = _size;
+				_size = s;
+			}
+
+			void					clear()
+			{
+				_words.clear();
+				_size = 0;
+			}
+
+			/*bit operations*/
+			bitvector&				set()
+			{
+				word_type*	w = data();
+				for (size_type i = 0; i < _words.size(); i++)
+					w[i] = ~static_cast<word_type>(0);
+				_trim();
+				return (*this);
+			}
+
+			bitvector&				set(size_type n, bool val = true)
+			{
+				(*this)[n] = val;
+				return (*this);
+			}
+
+			bitvector&				reset()
+			{
+				word_type*	w = data();
+				for (size_type i = 0; i < _words.size(); i++)
+					w[i] = 0;
+				return (*this);
+			}
+
+			bitvector&				reset(size_type n)
+			{
+				_words[n / bits_per_word] &= ~_bit(n);
+				return (*this);
+			}
+
+			bitvector&				flip()
+			{
+				word_type*	w = data();
+				for (size_type i = 0; i < _words.size(); i++)
+					w[i] = ~w[i];
+				_trim();
+				return (*this);
+			}
+
+			bitvector&				flip(size_type n)
+			{
+				_words[n / bits_per_word] ^= _bit(n);
+				return (*this);
+			}
+
+			bool					test(size_type n) const
+			{
+				return ((*this)[n]);
+			}
+
+			/*number of set bits*/
+			size_type				count() const
+			{
+				const word_type*	w = data();
+				size_type			c = 0;
+
+				for (size_type i = 0; i < _words.size(); i++)
+					c += popcount_word(w[i]);
+				return (c);
+			}
+
+			bool					any() const
+			{
+				const word_type*	w = data();
+				word_type			acc = 0;
+
+				for (size_type i = 0; i < _words.size(); i++)
+					acc |= w[i];
+				return (acc != 0);
+			}
+
+			bool					none() const
+			{
+				return (!any());
+			}
+
+			bool					all() const
+			{
+				const word_type*	w = data();
+				word_type			acc = ~static_cast<word_type>(0);
+				size_type			full = _size / bits_per_word;
+
+				for (size_type i = 0; i < full; i++)
+					acc &= w[i];
+				if (full != _words.size() && w[full] != _bit(_size) - 1)
+					return (false);
+				return (acc == ~static_cast<word_type>(0));
+			}
+
+			/*index of the first set bit, npos if none*/
+			size_type				find_first() const
+			{
+				return (_find_from(0));
+			}
+
+			/*index of the first set bit after n, npos if none*/
+			size_type				find_next(size_type n) const
+			{
+				if (n == npos)
+					return (npos);
+				return (_find_from(n + 1));
+			}
+
+			/*word-wise operations between bitvectors of the same size*/
+			bitvector&				operator&=(const bitvector& x)
+			{
+				word_type*			w = data();
+				const word_type*	v = x.data();
+
+				_check_size(x);
+				for (size_type i = 0; i < _words.size(); i++)
+					w[i] &= v[i];
+				return (*this);
+			}
+
+			bitvector&				operator|=(const bitvector& x)
+			{
+				word_type*			w = data();
+				const word_type*	v = x.data();
+
+				_check_size(x);
+				for (size_type i = 0; i < _words.size(); i++)
+					w[i] |= v[i];
+				return (*this);
+			}
+
+			bitvector&				operator^=(const bitvector& x)
+			{
+				word_type*			w = data();
+				const word_type*	v = x.data();
+
+				_check_size(x);
+				for (size_type i = 0; i < _words.size(); i++)
+					w[i] ^= v[i];
+				return (*this);
+			}
+
+			/*allocator*/
+			allocator_type			get_allocator() const
+			{
+				return (_words.get_allocator());
+			}
+	};
+
+	template<class Alloc> const typename bitvector<Alloc>::size_type	bitvector<Alloc>::bits_per_word;
+	template<class Alloc> const typename bitvector<Alloc>::size_type	bitvector<Alloc>::npos;
+
+	/*NON-MEMBER FUNCTION OVERLOADS*/
+	template<class Alloc> bool						operator==(const bitvector<Alloc>& lhs, const bitvector<Alloc>& rhs)
+	{
+		if (lhs.size() != rhs.size())
+			return (false);
+		return (ft::equal(lhs.data(), lhs.data() + lhs.num_words(), rhs.data()));
+	}
+
+	template<class Alloc> bool						operator!=(const bitvector<Alloc>& lhs, const bitvector<Alloc>& rhs)
+	{
+		return (!(lhs == rhs));
+	}
+
+	template<class Alloc> bitvector<Alloc>			operator&(const bitvector<Alloc>& lhs, const bitvector<Alloc>& rhs)
+	{
+		bitvector<Alloc>	r(lhs);
+		return (r &= rhs);
+	}
+
+	template<class Alloc> bitvector<Alloc>			operator|(const bitvector<Alloc>& lhs, const bitvector<Alloc>& rhs)
+	{
+		bitvector<Alloc>	r(lhs);
+		return (r |= rhs);
+	}
+
+	template<class Alloc> bitvector<Alloc>			operator^(const bitvector<Alloc>& lhs, const bitvector<Alloc>& rhs)
+	{
+		bitvector<Alloc>	r(lhs);
+		return (r ^= rhs);
+	}
+
+	template<class Alloc> bitvector<Alloc>			operator~(const bitvector<Alloc>& x)
+	{
+		bitvector<Alloc>	r(x);
+		return (r.flip());
+	}
+
+	template<class Alloc> void						swap(bitvector<Alloc>& x, bitvector<Alloc>& y)
+	{
+		x.swap(y);
+	}
+}
+
+#endif
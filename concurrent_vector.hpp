@@ -0,0 +1,693 @@
+#ifndef CONCURRENT_VECTOR_HPP
+# define CONCURRENT_VECTOR_HPP
+
+# include <cstring>
+# include <memory>
+# include <iterator>
+# include <stdexcept>
+# include "utils.hpp"
+
+/*
+** Elements in the first segment; every next segment doubles the capacity.
+*/
+# ifndef FT_CONCURRENT_FIRST_SEGMENT
+#  define FT_CONCURRENT_FIRST_SEGMENT 32
+# endif
+
+namespace ft
+{
+	/******************************/
+	/* CONCURRENT VECTOR ITERATOR */
+	/******************************/
+
+	/*
+	** Segment k holds B << k elements starting at index B * (2^k - 1), so
+	** the segment of index i is the highest bit of i / B + 1.
+	*/
+	template<size_t B> struct									concurrent_layout
+	{
+		static size_t	segment(size_t i)
+		{
+			return (sizeof(unsigned long) * 8 - 1 - __builtin_clzl(i / B + 1));
+		}
+
+		static size_t	first(size_t k)
+		{
+			return (B * ((static_cast<size_t>(1) << k) - 1));
+		}
+
+		static size_t	length(size_t k)
+		{
+			return (B << k);
+		}
+	};
+
+	/*
+	** Iterator keeping the segment table and an index, so it stays valid
+	** while other threads append.
+	*/
+	template<typename T, size_t B> class						concurrent_vector_iterator : public std::iterator<std::random_access_iterator_tag, T>
+	{
+		public:
+			/*MEMBER TYPES*/
+			typedef typename std::iterator<std::random_access_iterator_tag, T>::iterator_category	iterator_category;
+			typedef typename std::iterator<std::random_access_iterator_tag, T>::value_type			value_type;
+			typedef typename std::iterator<std::random_access_iterator_tag, T>::difference_type		difference_type;
+			typedef T*																				pointer;
+			typedef T&																				reference;
+
+		private:
+			/*variables*/
+			T* const*	_segments;
+			size_t		_pos;
+
+		public:
+			/*MEMBER FUNCTIONS*/
+			concurrent_vector_iterator() :
+				_segments(NULL),
+				_pos(0)
+			{}
+
+			concurrent_vector_iterator(T* const* segments, size_t pos) :
+				_segments(segments),
+				_pos(pos)
+			{}
+
+			T* const*						segments() const
+			{
+				return (_segments);
+			}
+
+			size_t							pos() const
+			{
+				return (_pos);
+			}
+
+			reference						operator*() const
+			{
+				size_t	k = concurrent_layout<B>::segment(_pos);
+				return (_segments[k][_pos - concurrent_layout<B>::first(k)]);
+			}
+
+			pointer							operator->() const
+			{
+				return &(operator*());
+			}
+
+			reference						operator[](difference_type n) const
+			{
+				return (*(*this + n));
+			}
+
+			concurrent_vector_iterator&		operator++()
+			{
+				_pos++;
+				return (*this);
+			}
+
+			concurrent_vector_iterator		operator++(int)
+			{
+				concurrent_vector_iterator	t(*this);
+				_pos++;
+				return (t);
+			}
+
+			concurrent_vector_iterator&		operator--()
+			{
+				_pos--;
+				return (*this);
+			}
+
+			concurrent_vector_iterator		operator--(int)
+			{
+				concurrent_vector_iterator	t(*this);
+				_pos--;
+				return (t);
+			}
+
+			concurrent_vector_iterator&		operator+=(difference_type n)
+			{
+				_pos += n;
+				return (*this);
+			}
+
+			concurrent_vector_iterator&		operator-=(difference_type n)
+			{
+				_pos -= n;
+				return (*this);
+			}
+
+			concurrent_vector_iterator		operator+(difference_type n) const
+			{
+				return (concurrent_vector_iterator(_segments, _pos + n));
+			}
+
+			concurrent_vector_iterator		operator-(difference_type n) const
+			{
+				return (concurrent_vector_iterator(_segments, _pos - n));
+			}
+
+			operator concurrent_vector_iterator<const T, B>() const
+			{
+				return (concurrent_vector_iterator<const T, B>(_segments, _pos));
+			}
+	};
+	/*NON-MEMBER FUNCTION OVERLOADS*/
+	template<typename T_lhs, typename T_rhs, size_t B> bool									operator==(const concurrent_vector_iterator<T_lhs, B>& lhs, const concurrent_vector_iterator<T_rhs, B>& rhs)
+	{
+		return (lhs.pos() == rhs.pos());
+	}
+
+	template<typename T_lhs, typename T_rhs, size_t B> bool									operator!=(const concurrent_vector_iterator<T_lhs, B>& lhs, const concurrent_vector_iterator<T_rhs, B>& rhs)
+	{
+		return (lhs.pos() != rhs.pos());
+	}
+
+	template<typename T_lhs, typename T_rhs, size_t B> bool									operator<(const concurrent_vector_iterator<T_lhs, B>& lhs, const concurrent_vector_iterator<T_rhs, B>& rhs)
+	{
+		return (lhs.pos() < rhs.pos());
+	}
+
+	template<typename T_lhs, typename T_rhs, size_t B> bool									operator<=(const concurrent_vector_iterator<T_lhs, B>& lhs, const concurrent_vector_iterator<T_rhs, B>& rhs)
+	{
+		return (lhs.pos() <= rhs.pos());
+	}
+
+	template<typename T_lhs, typename T_rhs, size_t B> bool									operator>(const concurrent_vector_iterator<T_lhs, B>& lhs, const concurrent_vector_iterator<T_rhs, B>& rhs)
+	{
+		return (lhs.pos() > rhs.pos());
+	}
+
+	template<typename T_lhs, typename T_rhs, size_t B> bool									operator>=(const concurrent_vector_iterator<T_lhs, B>& lhs, const concurrent_vector_iterator<T_rhs, B>& rhs)
+	{
+		return (lhs.pos() >= rhs.pos());
+	}
+
+	template<typename T, size_t B> concurrent_vector_iterator<T, B>							operator+(typename concurrent_vector_iterator<T, B>::difference_type n, const concurrent_vector_iterator<T, B>& it)
+	{
+		return (it + n);
+	}
+
+	template<typename T_lhs, typename T_rhs, size_t B> typename concurrent_vector_iterator<T_lhs, B>::difference_type	operator-(const concurrent_vector_iterator<T_lhs, B>& lhs, const concurrent_vector_iterator<T_rhs, B>& rhs)
+	{
+		return (static_cast<typename concurrent_vector_iterator<T_lhs, B>::difference_type>(lhs.pos() - rhs.pos()));
+	}
+
+	/*********************/
+	/* CONCURRENT VECTOR */
+	/*********************/
+
+	/*
+	** Grow-only vector any number of threads can append to and read from
+	** without a lock. Appends reserve their indices with one atomic add and
+	** store into segments of doubling size that are allocated once and
+	** never moved, so elements and references stay valid. Each slot has a
+	** ready bit. size() is the prefix of slots that are all constructed:
+	** whichever thread fills the slot that blocks it moves it forward.
+	** Elements below size() may be read concurrently. A slot whose copy
+	** threw is published dead (see dead()) instead of stalling size().
+	** Copy, assignment, clear and swap must not overlap any other call.
+	*/
+	template<class T, class Alloc = std::allocator<T>, size_t FirstSegment = FT_CONCURRENT_FIRST_SEGMENT> class	concurrent_vector
+	{
+		public:
+			/*segment table entries, enough for any size_t index*/
+			static const size_t		segment_count = sizeof(size_t) * 8;
+
+			/*MEMBER TYPES*/
+			typedef T																	value_type;
+			typedef Alloc																allocator_type;
+			typedef typename allocator_type::reference									reference;
+			typedef typename allocator_type::const_reference							const_reference;
+			typedef typename allocator_type::pointer									pointer;
+			typedef typename allocator_type::const_pointer								const_pointer;
+			typedef ft::concurrent_vector_iterator<value_type, FirstSegment>			iterator;
+			typedef ft::concurrent_vector_iterator<const value_type, FirstSegment>		const_iterator;
+			typedef ft::reverse_iterator<iterator>										reverse_iterator;
+			typedef ft::reverse_iterator<const_iterator>								const_reverse_iterator;
+			typedef typename allocator_type::difference_type							difference_type;
+			typedef typename allocator_type::size_type									size_type;
+
+		private:
+			typedef concurrent_layout<FirstSegment>	layout;
+
+			/*variables*/
+			allocator_type	_allocator;
+			pointer			_segments[segment_count];
+			size_type		_reserved;
+			size_type		_size;
+
+			/*functions*/
+			static const size_t		_word_bits = sizeof(unsigned long) * 8;
+
+			/*
+			** Segment k is allocated as its elements followed by two bitmaps
+			** in words starting at the first aligned byte: one ready bit per
+			** constructed element, then one skip bit per dead slot.
+			*/
+			static size_type	_ready_offset(size_type k)
+			{
+				return ((layout::length(k) * sizeof(value_type) + sizeof(unsigned long) - 1) & ~(sizeof(unsigned long) - 1));
+			}
+
+			static size_type	_ready_words(size_type k)
+			{
+				return ((layout::length(k) + _word_bits - 1) / _word_bits);
+			}
+
+			static size_type	_slots(size_type k)
+			{
+				return ((_ready_offset(k) + 2 * _ready_words(k) * sizeof(unsigned long) + sizeof(value_type) - 1) / sizeof(value_type));
+			}
+
+			static unsigned long*	_ready(pointer segment, size_type k)
+			{
+				return (reinterpret_cast<unsigned long*>(reinterpret_cast<char*>(segment) + _ready_offset(k)));
+			}
+
+			static unsigned long*	_skip(pointer segment, size_type k)
+			{
+				return (_ready(segment, k) + _ready_words(k));
+			}
+
+			pointer				_segment(size_type k) const
+			{
+				return (__atomic_load_n(&_segments[k], __ATOMIC_ACQUIRE));
+			}
+
+			/*segment k, allocated by the first thread needing it*/
+			pointer				_ensure(size_type k)
+			{
+				pointer	s = _segment(k);
+
+				if (s)
+					return (s);
+				s = _allocator.allocate(_slots(k));
+				std::memset(static_cast<void*>(_ready(s, k)), 0, 2 * _ready_words(k) * sizeof(unsigned long));
+				if (__sync_bool_compare_and_swap(&_segments[k], static_cast<pointer>(NULL), s))
+					return (s);
+				_allocator.deallocate(s, _slots(k));
+				return (_segment(k));
+			}
+
+			/*allocates every segment overlapping [first, last), last > first*/
+			void				_ensure_range(size_type first, size_type last)
+			{
+				for (size_type k = layout::segment(first); k <= layout::segment(last - 1); k++)
+					_ensure(k);
+			}
+
+			/*sets the ready (or skip) bits of [first, last)*/
+			void				_mark(size_type first, size_type last, bool dead)
+			{
+				for (size_type i = first; i < last;)
+				{
+					size_type		k = layout::segment(i);
+					size_type		bit = (i - layout::first(k)) % _word_bits;
+					size_type		stop = layout::first(k) + layout::length(k) < last ? layout::first(k) + layout::length(k) : last;
+					size_type		n = _word_bits - bit < stop - i ? _word_bits - bit : stop - i;
+					unsigned long	mask = (n == _word_bits ? ~0UL : (1UL << n) - 1) << bit;
+					unsigned long*	words = dead ? _skip(_segments[k], k) : _ready(_segments[k], k);
+					__atomic_fetch_or(words + (i - layout::first(k)) / _word_bits, mask, __ATOMIC_SEQ_CST);
+					i += n;
+				}
+			}
+
+			/*
+			** Advances _size over every slot marked ready or skipped. The
+			** thread whose slot held _size back always sees its own bit set
+			** after marking it, so the last one to finish moves _size past it.
+			*/
+			void				_advance()
+			{
+				size_type	s = __atomic_load_n(&_size, __ATOMIC_SEQ_CST);
+				for (;;)
+				{
+					size_type	t = s;
+					size_type	end = __atomic_load_n(&_reserved, __ATOMIC_SEQ_CST);
+					while (t < end)
+					{
+						size_type		k = layout::segment(t);
+						pointer			seg = _segment(k);
+						if (!seg)
+							break ;
+						size_type		stop = layout::first(k) + layout::length(k);
+						size_type		bit = (t - layout::first(k)) % _word_bits;
+						size_type		w = (t - layout::first(k)) / _word_bits;
+						unsigned long	done = __atomic_load_n(_ready(seg, k) + w, __ATOMIC_SEQ_CST) | __atomic_load_n(_skip(seg, k) + w, __ATOMIC_SEQ_CST);
+						unsigned long	missing = ~done >> bit;
+						size_type		ready = missing ? __builtin_ctzl(missing) : _word_bits - bit;
+						if (t + ready < stop && missing)
+						{
+							t += ready;
+							break ;
+						}
+						t = t + ready < stop ? t + ready : stop;
+					}
+					t = t < end ? t : end;
+					if (t == s)
+						return ;
+					size_type	seen = __sync_val_compare_and_swap(&_size, s, t);
+					s = seen == s ? t : seen;
+				}
+			}
+
+			/*
+			** Reserves n consecutive indices. The length check and the segment
+			** allocations happen before the indices are taken, so once they
+			** are, only the element copies can still throw.
+			*/
+			size_type			_reserve(size_type n)
+			{
+				size_type	first = __atomic_load_n(&_reserved, __ATOMIC_SEQ_CST);
+
+				for (;;)
+				{
+					if (n > max_size() - first)
+						throw std::length_error("L");
+					_ensure_range(first, first + n);
+					size_type	seen = __sync_val_compare_and_swap(&_reserved, first, first + n);
+					if (seen == first)
+						return (first);
+					first = seen;
+				}
+			}
+
+			/*
+			** Fills the reserved slots [first, last) with val and publishes
+			** them. A failed copy leaves its slot and the rest of the range
+			** dead: skipped by _size, never read or destroyed.
+			*/
+			void				_fill(size_type first, size_type last, const value_type& val)
+			{
+				size_type	i = first;
+
+				try
+				{
+					while (i < last)
+					{
+						size_type	k = layout::segment(i);
+						pointer		seg = _segment(k);
+						size_type	stop = layout::first(k) + layout::length(k) < last ? layout::first(k) + layout::length(k) : last;
+						for (; i < stop; i++)
+							_allocator.construct(seg + i - layout::first(k), val);
+					}
+				}
+				catch (...)
+				{
+					_mark(first, i, false);
+					_mark(i, last, true);
+					_advance();
+					throw;
+				}
+				_mark(first, last, false);
+				_advance();
+			}
+
+			void				_destroy()
+			{
+				for (size_type k = 0; k < segment_count; k++)
+				{
+					if (!_segments[k])
+						continue ;
+					unsigned long*	ready = _ready(_segments[k], k);
+					for (size_type i = 0; i < layout::length(k); i++)
+						if (ready[i / _word_bits] >> (i % _word_bits) & 1)
+							_allocator.destroy(_segments[k] + i);
+					_allocator.deallocate(_segments[k], _slots(k));
+					_segments[k] = NULL;
+				}
+				_reserved = 0;
+				_size = 0;
+			}
+
+		public:
+			/*MEMBER FUNCTIONS*/
+			explicit							concurrent_vector(const allocator_type& alloc = allocator_type()) :
+				_allocator(alloc),
+				_reserved(0),
+				_size(0)
+			{
+				for (size_type k = 0; k < segment_count; k++)
+					_segments[k] = NULL;
+			}
+
+			explicit							concurrent_vector(size_type n, const value_type& val = value_type(), const allocator_type& alloc = allocator_type()) :
+				_allocator(alloc),
+				_reserved(0),
+				_size(0)
+			{
+				for (size_type k = 0; k < segment_count; k++)
+					_segments[k] = NULL;
+				try
+				{
+					grow_by(n, val);
+				}
+				catch (...)
+				{
+					_destroy();
+					throw;
+				}
+			}
+
+			/*copies element by element; dead slots stay dead at the same index*/
+			concurrent_vector(const concurrent_vector& x) :
+				_allocator(x._allocator),
+				_reserved(0),
+				_size(0)
+			{
+				for (size_type k = 0; k < segment_count; k++)
+					_segments[k] = NULL;
+				try
+				{
+					for (size_type i = 0; i < x.size(); i++)
+					{
+						if (!x.dead(i))
+						{
+							push_back(x[i]);
+							continue ;
+						}
+						_mark(_reserve(1), i + 1, true);
+						_advance();
+					}
+				}
+				catch (...)
+				{
+					_destroy();
+					throw;
+				}
+			}
+
+			~concurrent_vector()
+			{
+				_destroy();
+			}
+
+			concurrent_vector&					operator=(const concurrent_vector& x)
+			{
+				if (this != &x)
+				{
+					concurrent_vector	t(x);
+					swap(t);
+				}
+				return (*this);
+			}
+
+			/*iterators*/
+			iterator							begin()
+			{
+				return (iterator(_segments, 0));
+			}
+
+			const_iterator						begin() const
+			{
+				return (const_iterator(_segments, 0));
+			}
+
+			iterator							end()
+			{
+				return (iterator(_segments, size()));
+			}
+
+			const_iterator						end() const
+			{
+				return (const_iterator(_segments, size()));
+			}
+
+			reverse_iterator					rbegin()
+			{
+				return (reverse_iterator(end()));
+			}
+
+			const_reverse_iterator				rbegin() const
+			{
+				return (const_reverse_iterator(end()));
+			}
+
+			reverse_iterator					rend()
+			{
+				return (reverse_iterator(begin()));
+			}
+
+			const_reverse_iterator				rend() const
+			{
+				return (const_reverse_iterator(begin()));
+			}
+
+			/*capacity*/
+			/*elements published so far; appends still in flight are not counted*/
+			size_type							size() const
+			{
+				return (__atomic_load_n(&_size, __ATOMIC_ACQUIRE));
+			}
+
+			size_type							max_size() const
+			{
+				return (_allocator.max_size() / 2);
+			}
+
+			/*elements storable before the next segment allocation*/
+			size_type							capacity() const
+			{
+				size_type	k = 0;
+				while (k < segment_count && _segment(k))
+					k++;
+				return (layout::first(k));
+			}
+
+			bool								empty() const
+			{
+				return (!size());
+			}
+
+			/*allocates the segments covering the first n elements*/
+			void								reserve(size_type n)
+			{
+				if (n > max_size())
+					throw std::length_error("L");
+				for (size_type k = 0; n && k <= layout::segment(n - 1); k++)
+					_ensure(k);
+			}
+
+			/*element access*/
+			reference							operator[](size_type n)
+			{
+				size_type	k = layout::segment(n);
+				return (_segments[k][n - layout::first(k)]);
+			}
+
+			const_reference						operator[](size_type n) const
+			{
+				size_type	k = layout::segment(n);
+				return (_segments[k][n - layout::first(k)]);
+			}
+
+			/*dead slots throw like indices past size()*/
+			reference							at(size_type n)
+			{
+				if (n >= size() || dead(n))
+					throw std::out_of_range("OOB");
+				return ((*this)[n]);
+			}
+
+			const_reference						at(size_type n) const
+			{
+				if (n >= size() || dead(n))
+					throw std::out_of_range("OOB");
+				return ((*this)[n]);
+			}
+
+			/*
+			** True for an index below size() holding no element: its copy
+			** threw during push_back or grow_by.
+			*/
+			bool								dead(size_type n) const
+			{
+				size_type	k = layout::segment(n);
+				size_type	i = n - layout::first(k);
+				return (!(__atomic_load_n(_ready(_segments[k], k) + i / _word_bits, __ATOMIC_ACQUIRE) >> (i % _word_bits) & 1));
+			}
+
+			reference							front()
+			{
+				return ((*this)[0]);
+			}
+
+			const_reference						front() const
+			{
+				return ((*this)[0]);
+			}
+
+			reference							back()
+			{
+				return ((*this)[size() - 1]);
+			}
+
+			const_reference						back() const
+			{
+				return ((*this)[size() - 1]);
+			}
+
+			/*modifiers*/
+			/*appends val; the returned iterator stays valid, even before size() covers it*/
+			iterator							push_back(const value_type& val)
+			{
+				return (grow_by(1, val));
+			}
+
+			/*
+			** Appends n copies of val at consecutive indices, returns the
+			** first. If a copy throws, the indices taken stay dead and the
+			** exception propagates; later appends are not held back.
+			*/
+			iterator							grow_by(size_type n, const value_type& val = value_type())
+			{
+				if (!n)
+					return (end());
+				size_type	first = _reserve(n);
+				_fill(first, first + n, val);
+				return (iterator(_segments, first));
+			}
+
+			void								swap(concurrent_vector& x)
+			{
+				allocator_type	a = x._allocator;
+				size_type		r = x._reserved;
+				size_type		s = x._size;
+
+				x._allocator = _allocator;
+				x._reserved = _reserved;
+				x._size = _size;
+				_allocator = a;
+				_reserved = r;
+				_size = s;
+				for (size_type k = 0; k < segment_count; k++)
+				{
+					pointer	p = x._segments[k];
+					x._segments[k] = _segments[k];
+					_segments[k] = p;
+				}
+			}
+
+			void								clear()
+			{
+				_destroy();
+			}
+
+			/*allocator*/
+			allocator_type						get_allocator() const
+			{
+				return (_allocator);
+			}
+	};
+
+	template<class T, class Alloc, size_t B> const size_t	concurrent_vector<T, Alloc, B>::segment_count;
+	template<class T, class Alloc, size_t B> const size_t	concurrent_vector<T, Alloc, B>::_word_bits;
+
+	template<class T, class Alloc, size_t B> void	swap(concurrent_vector<T, Alloc, B>& x, concurrent_vector<T, Alloc, B>& y)
+	{
+		x.swap(y);
+	}
+}
+
+#endif
@@ -0,0 +1,800 @@
+#ifndef DEQUE_HPP
+# define DEQUE_HPP
+
+# include <cstring>
+# include <memory>
+# include <iterator>
+# include <stdexcept>
+# include "utils.hpp"
+
+/*
+** Bytes per block; blocks hold at least 16 elements whatever sizeof(T).
+*/
+# ifndef FT_DEQUE_BLOCK_BYTES
+#  define FT_DEQUE_BLOCK_BYTES 4096
+# endif
+
+/*
+** Emptied blocks kept for reuse before being handed back to the allocator.
+*/
+# ifndef FT_DEQUE_BLOCK_CACHE
+#  define FT_DEQUE_BLOCK_CACHE 4
+# endif
+
+namespace ft
+{
+	/******************/
+	/* DEQUE ITERATOR */
+	/******************/
+
+	/*
+	** Position pos of the deque lives in block pos / B at slot pos % B; the
+	** iterator keeps the block map and that position, so every move is
+	** plain integer arithmetic.
+	*/
+	template<typename T, size_t B> class				deque_iterator : public std::iterator<std::random_access_iterator_tag, T>
+	{
+		public:
+			/*MEMBER TYPES*/
+			typedef typename std::iterator<std::random_access_iterator_tag, T>::iterator_category	iterator_category;
+			typedef typename std::iterator<std::random_access_iterator_tag, T>::value_type			value_type;
+			typedef typename std::iterator<std::random_access_iterator_tag, T>::difference_type		difference_type;
+			typedef T*																				pointer;
+			typedef T&																				reference;
+
+		private:
+			/*variables*/
+			T* const*	_map;
+			size_t		_pos;
+
+		public:
+			/*MEMBER FUNCTIONS*/
+			deque_iterator() :
+				_map(NULL),
+				_pos(0)
+			{}
+
+			deque_iterator(T* const* map, size_t pos) :
+				_map(map),
+				_pos(pos)
+			{}
+
+			T* const*					map() const
+			{
+				return (_map);
+			}
+
+			size_t						pos() const
+			{
+				return (_pos);
+			}
+
+			reference					operator*() const
+			{
+				return (_map[_pos / B][_pos % B]);
+			}
+
+			pointer						operator->() const
+			{
+				return &(operator*());
+			}
+
+			reference					operator[](difference_type n) const
+			{
+				size_t	p = _pos + n;
+				return (_map[p / B][p % B]);
+			}
+
+			deque_iterator&				operator++()
+			{
+				_pos++;
+				return (*this);
+			}
+
+			deque_iterator				operator++(int)
+			{
+				deque_iterator	t(*this);
+				_pos++;
+				return (t);
+			}
+
+			deque_iterator&				operator--()
+			{
+				_pos--;
+				return (*this);
+			}
+
+			deque_iterator				operator--(int)
+			{
+				deque_iterator	t(*this);
+				_pos--;
+				return (t);
+			}
+
+			deque_iterator&				operator+=(difference_type n)
+			{
+				_pos += n;
+				return (*this);
+			}
+
+			deque_iterator&				operator-=(difference_type n)
+			{
+				_pos -= n;
+				return (*this);
+			}
+
+			deque_iterator				operator+(difference_type n) const
+			{
+				return (deque_iterator(_map, _pos + n));
+			}
+
+			deque_iterator				operator-(difference_type n) const
+			{
+				return (deque_iterator(_map, _pos - n));
+			}
+
+			operator deque_iterator<const T, B>() const
+			{
+				return (deque_iterator<const T, B>(_map, _pos));
+			}
+	};
+	/*NON-MEMBER FUNCTION OVERLOADS*/
+	template<typename T_lhs, typename T_rhs, size_t B> bool							operator==(const deque_iterator<T_lhs, B>& lhs, const deque_iterator<T_rhs, B>& rhs)
+	{
+		return (lhs.pos() == rhs.pos());
+	}
+
+	template<typename T_lhs, typename T_rhs, size_t B> bool							operator!=(const deque_iterator<T_lhs, B>& lhs, const deque_iterator<T_rhs, B>& rhs)
+	{
+		return (lhs.pos() != rhs.pos());
+	}
+
+	template<typename T_lhs, typename T_rhs, size_t B> bool							operator<(const deque_iterator<T_lhs, B>& lhs, const deque_iterator<T_rhs, B>& rhs)
+	{
+		return (lhs.pos() < rhs.pos());
+	}
+
+	template<typename T_lhs, typename T_rhs, size_t B> bool							operator<=(const deque_iterator<T_lhs, B>& lhs, const deque_iterator<T_rhs, B>& rhs)
+	{
+		return (lhs.pos() <= rhs.pos());
+	}
+
+	template<typename T_lhs, typename T_rhs, size_t B> bool							operator>(const deque_iterator<T_lhs, B>& lhs, const deque_iterator<T_rhs, B>& rhs)
+	{
+		return (lhs.pos() > rhs.pos());
+	}
+
+	template<typename T_lhs, typename T_rhs, size_t B> bool							operator>=(const deque_iterator<T_lhs, B>& lhs, const deque_iterator<T_rhs, B>& rhs)
+	{
+		return (lhs.pos() >= rhs.pos());
+	}
+
+	template<typename T, size_t B> deque_iterator<T, B>								operator+(typename deque_iterator<T, B>::difference_type n, const deque_iterator<T, B>& it)
+	{
+		return (it + n);
+	}
+
+	template<typename T_lhs, typename T_rhs, size_t B> typename deque_iterator<T_lhs, B>::difference_type	operator-(const deque_iterator<T_lhs, B>& lhs, const deque_iterator<T_rhs, B>& rhs)
+	{
+		return (static_cast<typename deque_iterator<T_lhs, B>::difference_type>(lhs.pos() - rhs.pos()));
+	}
+
+	/*********/
+	/* DEQUE */
+	/*********/
+
+	/*
+	** Double-ended queue over fixed-size blocks reached through a map of
+	** block pointers. Only blocks overlapping [_start, _start + _size) are
+	** held; blocks emptied at either end go to a small cache first, so a
+	** deque oscillating around a block boundary never reaches the allocator.
+	*/
+	template<class T, class Alloc = std::allocator<T>, size_t BlockBytes = FT_DEQUE_BLOCK_BYTES> class	deque
+	{
+		public:
+			/*elements per block*/
+			static const size_t		block_size = sizeof(T) < BlockBytes / 16 ? BlockBytes / sizeof(T) : 16;
+
+			/*MEMBER TYPES*/
+			typedef T													value_type;
+			typedef Alloc												allocator_type;
+			typedef typename allocator_type::reference					reference;
+			typedef typename allocator_type::const_reference			const_reference;
+			typedef typename allocator_type::pointer					pointer;
+			typedef typename allocator_type::const_pointer				const_pointer;
+			typedef ft::deque_iterator<value_type, block_size>			iterator;
+			typedef ft::deque_iterator<const value_type, block_size>	const_iterator;
+			typedef ft::reverse_iterator<iterator>						reverse_iterator;
+			typedef ft::reverse_iterator<const_iterator>				const_reverse_iterator;
+			typedef typename allocator_type::difference_type			difference_type;
+			typedef typename allocator_type::size_type					size_type;
+
+		private:
+			typedef typename allocator_type::template rebind<pointer>::other	map_allocator;
+
+			/*variables*/
+			allocator_type		_allocator;
+			map_allocator		_map_allocator;
+			pointer*			_map;
+			size_type			_map_size;
+			size_type			_start;
+			size_type			_size;
+			pointer				_cache[FT_DEQUE_BLOCK_CACHE];
+			size_type			_cached;
+			pointer				_tail;
+			pointer				_tail_end;
+
+			/*functions*/
+			/*
+			** _tail is one past the last element and _tail_end the end of its
+			** block (both NULL while empty), so push_back/pop_back skip the map
+			** until they cross a block boundary.
+			*/
+			void				_sync_tail()
+			{
+				if (!_size)
+				{
+					_tail = NULL;
+					_tail_end = NULL;
+					return ;
+				}
+				size_type	pos = _start + _size - 1;
+				_tail_end = _map[pos / block_size] + block_size;
+				_tail = _tail_end - block_size + pos % block_size + 1;
+			}
+
+			pointer				_slot(size_type pos) const
+			{
+				return (_map[pos / block_size] + pos % block_size);
+			}
+
+			pointer				_get_block()
+			{
+				if (_cached)
+					return (_cache[--_cached]);
+				return (_allocator.allocate(block_size));
+			}
+
+			void				_put_block(pointer b)
+			{
+				if (_cached < FT_DEQUE_BLOCK_CACHE)
+					_cache[_cached++] = b;
+				else
+					_allocator.deallocate(b, block_size);
+			}
+
+			void				_release_cache()
+			{
+				while (_cached)
+					_allocator.deallocate(_cache[--_cached], block_size);
+			}
+
+			/*
+			** Makes room for one more block at the front or the back of the
+			** map: recenters the used blocks when the map is at most half
+			** full, otherwise moves them to a map twice as large.
+			*/
+			void				_grow_map()
+			{
+				size_type	first = _start / block_size;
+				size_type	used = _size ? (_start + _size - 1) / block_size - first + 1 : 0;
+				size_type	n = _map_size;
+				if (used * 2 >= n)
+					n = n * 2 < 8 ? 8 : n * 2;
+				size_type	at = (n - used) / 2;
+				if (n == _map_size)
+					std::memmove(static_cast<void*>(_map + at), static_cast<const void*>(_map + first), used * sizeof(pointer));
+				else
+				{
+					pointer*	m = _map_allocator.allocate(n);
+					if (used)
+						std::memcpy(static_cast<void*>(m + at), static_cast<const void*>(_map + first), used * sizeof(pointer));
+					if (_map)
+						_map_allocator.deallocate(_map, _map_size);
+					_map = m;
+					_map_size = n;
+				}
+				_start = at * block_size + (_size ? _start % block_size : block_size / 2);
+			}
+
+			/*
+			** Maps a block for the slot right after the back (before the
+			** front). Only called when that slot starts a block or the deque is
+			** empty; elements never move, so references to them stay valid.
+			*/
+			FT_COLD void		_reserve_back()
+			{
+				if ((_start + _size) / block_size >= _map_size)
+					_grow_map();
+				_map[(_start + _size) / block_size] = _get_block();
+			}
+
+			FT_COLD void		_reserve_front()
+			{
+				if (_start == 0)
+					_grow_map();
+				_map[(_start - 1) / block_size] = _get_block();
+			}
+
+			void				_swap_elements(size_type a, size_type b)
+			{
+				value_type	t((*this)[a]);
+				(*this)[a] = (*this)[b];
+				(*this)[b] = t;
+			}
+
+			void				_reverse(size_type first, size_type last)
+			{
+				while (first + 1 < last)
+					_swap_elements(first++, --last);
+			}
+
+			/*rotates [first, last) so that middle becomes first*/
+			void				_rotate(size_type first, size_type middle, size_type last)
+			{
+				_reverse(first, middle);
+				_reverse(middle, last);
+				_reverse(first, last);
+			}
+
+			/*
+			** The n elements just added at the back (or front) are rotated
+			** into place at index p, moving whichever side of p is shorter.
+			*/
+			void				_place_back(size_type p, size_type n)
+			{
+				_rotate(p, _size - n, _size);
+			}
+
+			void				_place_front(size_type p, size_type n)
+			{
+				_reverse(0, n);
+				_rotate(0, n, n + p);
+			}
+
+			template <class InputIterator> void		_range_insert(size_type p, InputIterator first, InputIterator last, std::input_iterator_tag)
+			{
+				deque	t(_allocator);
+				for (; first != last; ++first)
+					t.push_back(*first);
+				_range_insert(p, t.begin(), t.end(), std::random_access_iterator_tag());
+			}
+
+			template <class ForwardIterator> void	_range_insert(size_type p, ForwardIterator first, ForwardIterator last, std::forward_iterator_tag)
+			{
+				size_type	n = 0;
+				if (p < _size / 2)
+				{
+					for (; first != last; ++first, ++n)
+						push_front(*first);
+					_place_front(p, n);
+					return ;
+				}
+				for (; first != last; ++first, ++n)
+					push_back(*first);
+				_place_back(p, n);
+			}
+
+		public:
+			/*MEMBER FUNCTIONS*/
+			explicit								deque(const allocator_type& alloc = allocator_type()) :
+				_allocator(alloc),
+				_map_allocator(alloc),
+				_map(NULL),
+				_map_size(0),
+				_start(0),
+				_size(0),
+				_cached(0),
+				_tail(NULL),
+				_tail_end(NULL)
+			{}
+
+			explicit								deque(size_type n, const value_type& val = value_type(), const allocator_type& alloc = allocator_type()) :
+				_allocator(alloc),
+				_map_allocator(alloc),
+				_map(NULL),
+				_map_size(0),
+				_start(0),
+				_size(0),
+				_cached(0),
+				_tail(NULL),
+				_tail_end(NULL)
+			{
+				while (n--)
+					push_back(val);
+			}
+
+			template <class InputIterator>			deque(InputIterator first, InputIterator last, const allocator_type& alloc = allocator_type(), typename ft::enable_if<!is_integral<InputIterator>::value, InputIterator>::type* = NULL) :
+				_allocator(alloc),
+				_map_allocator(alloc),
+				_map(NULL),
+				_map_size(0),
+				_start(0),
+				_size(0),
+				_cached(0),
+				_tail(NULL),
+				_tail_end(NULL)
+			{
+				for (; first != last; ++first)
+					push_back(*first);
+			}
+
+			deque(const deque& x) :
+				_allocator(x._allocator),
+				_map_allocator(x._map_allocator),
+				_map(NULL),
+				_map_size(0),
+				_start(0),
+				_size(0),
+				_cached(0),
+				_tail(NULL),
+				_tail_end(NULL)
+			{
+				for (const_iterator it = x.begin(); it != x.end(); ++it)
+					push_back(*it);
+			}
+
+			~deque()
+			{
+				clear();
+				_release_cache();
+				if (_map)
+					_map_allocator.deallocate(_map, _map_size);
+			}
+
+			deque&									operator=(const deque& x)
+			{
+				if (this != &x)
+					assign(x.begin(), x.end());
+				return (*this);
+			}
+
+			/*iterators*/
+			iterator								begin()
+			{
+				return (iterator(_map, _start));
+			}
+
+			const_iterator							begin() const
+			{
+				return (const_iterator(_map, _start));
+			}
+
+			iterator								end()
+			{
+				return (iterator(_map, _start + _size));
+			}
+
+			const_iterator							end() const
+			{
+				return (const_iterator(_map, _start + _size));
+			}
+
+			reverse_iterator						rbegin()
+			{
+				return (reverse_iterator(end()));
+			}
+
+			const_reverse_iterator					rbegin() const
+			{
+				return (const_reverse_iterator(end()));
+			}
+
+			reverse_iterator						rend()
+			{
+				return (reverse_iterator(begin()));
+			}
+
+			const_reverse_iterator					rend() const
+			{
+				return (const_reverse_iterator(begin()));
+			}
+
+			/*capacity*/
+			size_type								size() const
+			{
+				return (_size);
+			}
+
+			size_type								max_size() const
+			{
+				return (_allocator.max_size());
+			}
+
+			void									resize(size_type n, value_type val = value_type())
+			{
+				while (_size > n)
+					pop_back();
+				while (_size < n)
+					push_back(val);
+			}
+
+			bool									empty() const
+			{
+				return (_size == 0);
+			}
+
+			/*hands the cached blocks back to the allocator*/
+			void									shrink_to_fit()
+			{
+				_release_cache();
+			}
+
+			/*element access*/
+			reference								operator[](size_type n)
+			{
+				return (*_slot(_start + n));
+			}
+
+			const_reference							operator[](size_type n) const
+			{
+				return (*_slot(_start + n));
+			}
+
+			reference								at(size_type n)
+			{
+				if (n >= _size)
+					throw std::out_of_range("OOB");
+				return (*_slot(_start + n));
+			}
+
+			const_reference							at(size_type n) const
+			{
+				if (n >= _size)
+					throw std::out_of_range("OOB");
+				return (*_slot(_start + n));
+			}
+
+			reference								front()
+			{
+				return (*_slot(_start));
+			}
+
+			const_reference							front() const
+			{
+				return (*_slot(_start));
+			}
+
+			reference								back()
+			{
+				return (*(_tail - 1));
+			}
+
+			const_reference							back() const
+			{
+				return (*(_tail - 1));
+			}
+
+			/*modifiers*/
+			template <class InputIterator> void		assign(InputIterator first, InputIterator last, typename ft::enable_if<!is_integral<InputIterator>::value, InputIterator>::type* = NULL)
+			{
+				size_type	i = 0;
+				for (; first != last && i < _size; ++first, ++i)
+					(*this)[i] = *first;
+				while (_size > i)
+					pop_back();
+				for (; first != last; ++first)
+					push_back(*first);
+			}
+
+			void									assign(size_type n, const value_type& val)
+			{
+				value_type	t(val);
+				size_type	i = 0;
+				for (; i < n && i < _size; ++i)
+					(*this)[i] = t;
+				while (_size > n)
+					pop_back();
+				while (_size < n)
+					push_back(t);
+			}
+
+			void									push_back(const value_type& val)
+			{
+				if (_tail != _tail_end)
+				{
+					_allocator.construct(_tail, val);
+					_tail++;
+					_size++;
+					return ;
+				}
+				_reserve_back();
+				_allocator.construct(_slot(_start + _size), val);
+				_size++;
+				_sync_tail();
+			}
+
+			void									push_front(const value_type& val)
+			{
+				if (!_size || _start % block_size == 0)
+					_reserve_front();
+				_allocator.construct(_slot(_start - 1), val);
+				_start--;
+				_size++;
+				if (_size == 1)
+					_sync_tail();
+			}
+
+			void									pop_back()
+			{
+				if (_size > 1 && _tail - 1 != _tail_end - block_size)
+				{
+					_tail--;
+					_allocator.destroy(_tail);
+					_size--;
+					return ;
+				}
+				size_type	pos = _start + _size - 1;
+				_allocator.destroy(_slot(pos));
+				if (_size == 1 || pos % block_size == 0)
+					_put_block(_map[pos / block_size]);
+				_size--;
+				_sync_tail();
+			}
+
+			void									pop_front()
+			{
+				_allocator.destroy(_slot(_start));
+				if (_size == 1 || (_start + 1) % block_size == 0)
+					_put_block(_map[_start / block_size]);
+				_start++;
+				_size--;
+				if (!_size)
+					_sync_tail();
+			}
+
+			iterator								insert(iterator position, const value_type& val)
+			{
+				size_type	p = position - begin();
+				insert(position, 1, val);
+				return (begin() + p);
+			}
+
+			void									insert(iterator position, size_type n, const value_type& val)
+			{
+				size_type	p = position - begin();
+				value_type	t(val);
+				if (p < _size / 2)
+				{
+					for (size_type i = 0; i < n; i++)
+						push_front(t);
+					_rotate(0, n, n + p);
+					return ;
+				}
+				for (size_type i = 0; i < n; i++)
+					push_back(t);
+				_place_back(p, n);
+			}
+
+			template <class InputIterator> void		insert(iterator position, InputIterator first, InputIterator last, typename ft::enable_if<!is_integral<InputIterator>::value, InputIterator>::type* = NULL)
+			{
+				_range_insert(position - begin(), first, last, typename ft::iterator_traits<InputIterator>::iterator_category());
+			}
+
+			iterator								erase(iterator position)
+			{
+				return (erase(position, position + 1));
+			}
+
+			/*shifts whichever side of the hole is shorter, then pops that end*/
+			iterator								erase(iterator first, iterator last)
+			{
+				size_type	f = first - begin();
+				size_type	l = last - begin();
+				size_type	n = l - f;
+				if (!n)
+					return (begin() + f);
+				if (f < _size - l)
+				{
+					for (size_type i = f; i > 0; i--)
+						(*this)[i - 1 + n] = (*this)[i - 1];
+					while (n--)
+						pop_front();
+				}
+				else
+				{
+					for (size_type i = l; i < _size; i++)
+						(*this)[i - n] = (*this)[i];
+					while (n--)
+						pop_back();
+				}
+				return (begin() + f);
+			}
+
+			void									swap(deque& x)
+			{
+				allocator_type	a = x._allocator;
+				map_allocator	ma = x._map_allocator;
+				pointer*		m = x._map;
+				size_type		ms = x._map_size;
+				size_type		st = x._start;
+				size_type		s = x._size;
+
+				x._allocator = _allocator;
+				x._map_allocator = _map_allocator;
+				x._map = _map;
+				x._map_size = _map_size;
+				x._start = _start;
+				x._size = _size;
+
+				_allocator = a;
+				_map_allocator = ma;
+				_map = m;
+				_map_size = ms;
+				_start = st;
+				_size = s;
+
+				for (size_type i = 0; i < FT_DEQUE_BLOCK_CACHE; i++)
+				{
+					pointer	b = x._cache[i];
+					x._cache[i] = _cache[i];
+					_cache[i] = b;
+				}
+				size_type	c = x._cached;
+				x._cached = _cached;
+				_cached = c;
+				_sync_tail();
+				x._sync_tail();
+			}
+
+			void									clear()
+			{
+				if (!_size)
+					return ;
+				for (size_type pos = _start; pos < _start + _size; pos++)
+					_allocator.destroy(_slot(pos));
+				for (size_type b = _start / block_size; b <= (_start + _size - 1) / block_size; b++)
+					_put_block(_map[b]);
+				_size = 0;
+				_sync_tail();
+			}
+
+			/*allocator*/
+			allocator_type							get_allocator() const
+			{
+				return (_allocator);
+			}
+	};
+
+	template<class T, class Alloc, size_t BlockBytes> const size_t	deque<T, Alloc, BlockBytes>::block_size;
+
+	/*NON-MEMBER FUNCTION OVERLOADS*/
+	template<class T, class Alloc, size_t B> bool	operator==(const deque<T, Alloc, B>& lhs, const deque<T, Alloc, B>& rhs)
+	{
+		if (lhs.size() != rhs.size())
+			return (false);
+		return (ft::equal(lhs.begin(), lhs.end(), rhs.begin()));
+	}
+
+	template<class T, class Alloc, size_t B> bool	operator!=(const deque<T, Alloc, B>& lhs, const deque<T, Alloc, B>& rhs)
+	{
+		return (!(lhs == rhs));
+	}
+
+	template<class T, class Alloc, size_t B> bool	operator<(const deque<T, Alloc, B>& lhs, const deque<T, Alloc, B>& rhs)
+	{
+		return (ft::lexicographical_compare(lhs.begin(), lhs.end(), rhs.begin(), rhs.end()));
+	}
+
+	template<class T, class Alloc, size_t B> bool	operator<=(const deque<T, Alloc, B>& lhs, const deque<T, Alloc, B>& rhs)
+	{
+		return (!(rhs < lhs));
+	}
+
+	template<class T, class Alloc, size_t B> bool	operator>(const deque<T, Alloc, B>& lhs, const deque<T, Alloc, B>& rhs)
+	{
+		return (rhs < lhs);
+	}
+
+	template<class T, class Alloc, size_t B> bool	operator>=(const deque<T, Alloc, B>& lhs, const deque<T, Alloc, B>& rhs)
+	{
+		return (!(lhs < rhs));
+	}
+
+	template<class T, class Alloc, size_t B> void	swap(deque<T, Alloc, B>& x, deque<T, Alloc, B>& y)
+	{
+		x.swap(y);
+	}
+}
+
+#endif
@@ -0,0 +1,505 @@
+#ifndef INTERVAL_MAP_HPP
+# define INTERVAL_MAP_HPP
+
+# include <memory>
+# include <iterator>
+# include <stdexcept>
+# include "utils.hpp"
+# include "vector.hpp"
+
+namespace ft
+{
+	/*****************/
+	/* INTERVAL NODE */
+	/*****************/
+
+	/*
+	** bst node augmented with the largest interval end found in its subtree
+	** and its AVL height. Both are recomputed bottom-up after every link
+	** change, rotations included.
+	*/
+	template<typename T, typename Key> struct	interval_node : public bst_node
+	{
+		T		val;
+		Key		max;
+		int		height;
+		interval_node(const T& v, bst_node* par = NULL) :
+			bst_node(NULL, NULL, par),
+			val(v),
+			max(v.first.second),
+			height(1)
+		{}
+
+		T&		value()
+		{
+			return (val);
+		}
+	};
+
+	/****************/
+	/* INTERVAL MAP */
+	/****************/
+
+	/*
+	** Ordered map from closed intervals [first, second] to T, sorted by
+	** (first, second). Overlap queries prune every subtree whose max end is
+	** below the query start, so they run in O(log n + k).
+	*/
+	template < class Key, class T, class Compare = std::less<Key>, class Alloc = std::allocator<ft::pair<const ft::pair<Key, Key>, T> > > class interval_map
+	{
+		public:
+			/*MEMBER TYPES*/
+			typedef ft::pair<Key, Key>								key_type;
+			typedef T												mapped_type;
+			typedef ft::pair<const key_type, mapped_type>			value_type;
+			typedef Compare											endpoint_compare;
+			typedef Alloc											allocator_type;
+			typedef typename allocator_type::reference				reference;
+			typedef typename allocator_type::const_reference		const_reference;
+			typedef typename allocator_type::pointer				pointer;
+			typedef typename allocator_type::const_pointer			const_pointer;
+			typedef ft::interval_node<value_type, Key>				node_type;
+			typedef node_type*										node_pointer;
+			typedef typename allocator_type::template rebind<node_type>::other	node_allocator;
+			typedef ft::map_iterator<value_type, node_type>			iterator;
+			typedef ft::map_iterator<const value_type, node_type>	const_iterator;
+			typedef ft::reverse_iterator<iterator>					reverse_iterator;
+			typedef ft::reverse_iterator<const_iterator>			const_reverse_iterator;
+			typedef typename allocator_type::difference_type		difference_type;
+			typedef size_t											size_type;
+
+		private:
+			/*variables*/
+			node_allocator		_node_allocator;
+			size_type			_size;
+			bst_node			_header;
+			endpoint_compare	_comp;
+
+			/*functions*/
+			bst_node*		_end() const
+			{
+				return (const_cast<bst_node*>(&_header));
+			}
+
+			static node_pointer	_node(bst_node* n)
+			{
+				return (static_cast<node_pointer>(n));
+			}
+
+			bool			_less(const key_type& a, const key_type& b) const
+			{
+				return (_comp(a.first, b.first) || (!_comp(b.first, a.first) && _comp(a.second, b.second)));
+			}
+
+			static int		_height(bst_node* n)
+			{
+				return (n ? _node(n)->height : 0);
+			}
+
+			void			_update(bst_node* n)
+			{
+				node_pointer	bst = _node(n);
+				int				l = _height(n->left);
+				int				r = _height(n->right);
+				bst->height = 1 + (l > r ? l : r);
+				bst->max = bst->val.first.second;
+				if (n->left && _comp(bst->max, _node(n->left)->max))
+					bst->max = _node(n->left)->max;
+				if (n->right && _comp(bst->max, _node(n->right)->max))
+					bst->max = _node(n->right)->max;
+			}
+
+			void			_replace_child(bst_node* old, bst_node* n)
+			{
+				bst_node*	p = old->parent;
+				if (p->left == old)
+					p->left = n;
+				else
+					p->right = n;
+				if (n)
+					n->parent = p;
+			}
+
+			bst_node*		_rotate_left(bst_node* x)
+			{
+				bst_node*	y = x->right;
+				x->right = y->left;
+				if (y->left)
+					y->left->parent = x;
+				_replace_child(x, y);
+				y->left = x;
+				x->parent = y;
+				_update(x);
+				_update(y);
+				return (y);
+			}
+
+			bst_node*		_rotate_right(bst_node* x)
+			{
+				bst_node*	y = x->left;
+				x->left = y->right;
+				if (y->right)
+					y->right->parent = x;
+				_replace_child(x, y);
+				y->right = x;
+				x->parent = y;
+				_update(x);
+				_update(y);
+				return (y);
+			}
+
+			void			_rebalance(bst_node* n)
+			{
+				while (n != _end())
+				{
+					_update(n);
+					int	balance = _height(n->left) - _height(n->right);
+					if (balance > 1)
+					{
+						if (_height(n->left->left) < _height(n->left->right))
+							_rotate_left(n->left);
+						n = _rotate_right(n);
+					}
+					else if (balance < -1)
+					{
+						if (_height(n->right->right) < _height(n->right->left))
+							_rotate_right(n->right);
+						n = _rotate_left(n);
+					}
+					n = n->parent;
+				}
+			}
+
+			void			_destroy(bst_node* n)
+			{
+				_node_allocator.destroy(_node(n));
+				_node_allocator.deallocate(_node(n), 1);
+			}
+
+			void			_erase_node(bst_node* z)
+			{
+				bst_node*	start;
+				if (!z->left || !z->right)
+				{
+					start = z->parent;
+					_replace_child(z, z->left ? z->left : z->right);
+				}
+				else
+				{
+					bst_node*	y = smallest_leaf(z->right);
+					start = (y->parent == z) ? y : y->parent;
+					if (y->parent != z)
+					{
+						_replace_child(y, y->right);
+						y->right = z->right;
+						y->right->parent = y;
+					}
+					_replace_child(z, y);
+					y->left = z->left;
+					y->left->parent = y;
+				}
+				_destroy(z);
+				_size--;
+				_rebalance(start);
+			}
+
+			bst_node*		_lower_bound(const key_type& k) const
+			{
+				bst_node*	bst = _header.left;
+				bst_node*	ret = _end();
+				while (bst)
+				{
+					if (!_less(_node(bst)->val.first, k))
+					{
+						ret = bst;
+						bst = bst->left;
+					}
+					else
+						bst = bst->right;
+				}
+				return (ret);
+			}
+
+			bst_node*		_find(const key_type& k) const
+			{
+				bst_node*	bst = _lower_bound(k);
+				if (bst == _end() || _less(k, _node(bst)->val.first))
+					return (_end());
+				return (bst);
+			}
+
+			template<class Iterator> void	_overlaps(bst_node* n, const Key& lo, const Key& hi, ft::vector<Iterator>& out) const
+			{
+				while (n && !_comp(_node(n)->max, lo))
+				{
+					_overlaps(n->left, lo, hi, out);
+					const key_type&	k = _node(n)->val.first;
+					if (_comp(hi, k.first))
+						return ;
+					if (!_comp(k.second, lo))
+						out.push_back(Iterator(n));
+					n = n->right;
+				}
+			}
+
+		public:
+			/*MEMBER FUNCTIONS*/
+			explicit interval_map(const endpoint_compare& comp = endpoint_compare(), const allocator_type& alloc = allocator_type()) :
+				_node_allocator(alloc),
+				_size(0),
+				_header(),
+				_comp(comp)
+			{}
+
+			interval_map(const interval_map& x) :
+				_node_allocator(x._node_allocator),
+				_size(0),
+				_header(),
+				_comp(x._comp)
+			{
+				insert(x.begin(), x.end());
+			}
+
+			~interval_map()
+			{
+				clear();
+			}
+
+			interval_map&						operator=(const interval_map& x)
+			{
+				if (this == &x)
+					return (*this);
+				clear();
+				insert(x.begin(), x.end());
+				return (*this);
+			}
+
+			/*iterators*/
+			iterator							begin()
+			{
+				return (iterator(smallest_leaf(_end())));
+			}
+
+			const_iterator						begin() const
+			{
+				return (const_iterator(smallest_leaf(_end())));
+			}
+
+			iterator							end()
+			{
+				return (iterator(_end()));
+			}
+
+			const_iterator						end() const
+			{
+				return (const_iterator(_end()));
+			}
+
+			reverse_iterator					rbegin()
+			{
+				return (reverse_iterator(end()));
+			}
+
+			const_reverse_iterator				rbegin() const
+			{
+				return (const_reverse_iterator(end()));
+			}
+
+			reverse_iterator					rend()
+			{
+				return (reverse_iterator(begin()));
+			}
+
+			const_reverse_iterator				rend() const
+			{
+				return (const_reverse_iterator(begin()));
+			}
+
+			/*capacity*/
+			bool								empty() const
+			{
+				return (_size == 0);
+			}
+
+			size_type							size() const
+			{
+				return (_size);
+			}
+
+			size_type							max_size() const
+			{
+				return (_node_allocator.max_size());
+			}
+
+			/*element access*/
+			mapped_type&						operator[](const key_type& k)
+			{
+				return (*((insert(value_type(k, mapped_type()))).first)).second;
+			}
+
+			/*modifiers*/
+			pair<iterator, bool>				insert(const value_type& val)
+			{
+				if (_comp(val.first.second, val.first.first))
+					throw std::invalid_argument("interval_map: interval end before start");
+				bst_node*	parent = _end();
+				bst_node**	link = &_header.left;
+				while (*link)
+				{
+					parent = *link;
+					if (_less(val.first, _node(parent)->val.first))
+						link = &parent->left;
+					else if (_less(_node(parent)->val.first, val.first))
+						link = &parent->right;
+					else
+						return (pair<iterator, bool>(iterator(parent), false));
+				}
+				node_pointer	n = _node_allocator.allocate(1);
+				_node_allocator.construct(n, node_type(val, parent));
+				*link = n;
+				_size++;
+				_rebalance(parent);
+				return (pair<iterator, bool>(iterator(n), true));
+			}
+
+			template<class InputIterator> void	insert(InputIterator first, InputIterator last)
+			{
+				while (first != last)
+					insert(*first++);
+			}
+
+			void								erase(iterator position)
+			{
+				_erase_node(position.node());
+			}
+
+			size_type							erase(const key_type& k)
+			{
+				bst_node*	n = _find(k);
+				if (n == _end())
+					return (0);
+				_erase_node(n);
+				return (1);
+			}
+
+			void								swap(interval_map& x)
+			{
+				node_allocator		a = x._node_allocator;
+				size_type			s = x._size;
+				bst_node*			r = x._header.left;
+				endpoint_compare	c = x._comp;
+
+				x._node_allocator = _node_allocator;
+				x._size = _size;
+				x._header.left = _header.left;
+				x._comp = _comp;
+
+				_node_allocator = a;
+				_size = s;
+				_header.left = r;
+				_comp = c;
+
+				if (_header.left)
+					_header.left->parent = &_header;
+				if (x._header.left)
+					x._header.left->parent = &x._header;
+			}
+
+			void								clear()
+			{
+				bst_node*	bst = _header.left;
+				while (bst)
+				{
+					if (bst->left)
+						bst = bst->left;
+					else if (bst->right)
+						bst = bst->right;
+					else
+					{
+						bst_node*	p = bst->parent;
+						if (p->left == bst)
+							p->left = NULL;
+						else
+							p->right = NULL;
+						_destroy(bst);
+						bst = (p == _end()) ? NULL : p;
+					}
+				}
+				_size = 0;
+			}
+
+			/*observers*/
+			endpoint_compare					endpoint_comp() const
+			{
+				return (_comp);
+			}
+
+			/*operations*/
+			iterator							find(const key_type& k)
+			{
+				return (iterator(_find(k)));
+			}
+
+			const_iterator						find(const key_type& k) const
+			{
+				return (const_iterator(_find(k)));
+			}
+
+			size_type							count(const key_type& k) const
+			{
+				return (_find(k) != _end());
+			}
+
+			iterator							lower_bound(const key_type& k)
+			{
+				return (iterator(_lower_bound(k)));
+			}
+
+			const_iterator						lower_bound(const key_type& k) const
+			{
+				return (const_iterator(_lower_bound(k)));
+			}
+
+			/*interval queries*/
+			void								overlaps(const Key& lo, const Key& hi, ft::vector<iterator>& out)
+			{
+				_overlaps(_header.left, lo, hi, out);
+			}
+
+			void								overlaps(const Key& lo, const Key& hi, ft::vector<const_iterator>& out) const
+			{
+				_overlaps(_header.left, lo, hi, out);
+			}
+
+			bool								overlaps(const Key& lo, const Key& hi) const
+			{
+				bst_node*	n = _header.left;
+				while (n && !_comp(_node(n)->max, lo))
+				{
+					const key_type&	k = _node(n)->val.first;
+					if (!_comp(hi, k.first) && !_comp(k.second, lo))
+						return (true);
+					if (n->left && !_comp(_node(n->left)->max, lo))
+						n = n->left;
+					else if (_comp(hi, k.first))
+						return (false);
+					else
+						n = n->right;
+				}
+				return (false);
+			}
+
+			/*allocator*/
+			allocator_type						get_allocator() const
+			{
+				return (allocator_type(_node_allocator));
+			}
+	};
+
+	template<class Key, class T, class Compare, class Alloc> void	swap(interval_map<Key, T, Compare, Alloc>& lhs, interval_map<Key, T, Compare, Alloc>& rhs)
+	{
+		lhs.swap(rhs);
+	}
+}
+
+#endif
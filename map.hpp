@@ -2,12 +2,26 @@
 # define MAP_HPP
 
 # include <memory>
+# if __cplusplus >= 201103L
+#  include <utility>
+# endif
 # include <iterator>
 # include <stdexcept>
 # include "utils.hpp"
 
+# ifndef FT_MAP_SPLIT_THRESHOLD
+#  define FT_MAP_SPLIT_THRESHOLD 64
+# endif
+
 namespace ft
 {
+	/*
+	** Node layout policy: mapped types bigger than FT_MAP_SPLIT_THRESHOLD bytes
+	** are kept out of line (bst_split) so tree descents only read keys and
+	** links. Specialize for a mapped type to force either layout.
+	*/
+	template<class T> struct	map_split_values : public integral_constant<bool, (sizeof(T) > FT_MAP_SPLIT_THRESHOLD)> {};
+
 	template < class Key, class T, class Compare = std::less<Key>, class Alloc = std::allocator<ft::pair<const Key,T> > > class map
 	{
 		public:
@@ -33,7 +47,7 @@ namespace ft
 			typedef typename allocator_type::const_reference			const_reference;
 			typedef typename allocator_type::pointer						pointer;
 			typedef typename allocator_type::const_pointer						const_pointer;
-			typedef ft::bst<value_type>												bst_type;
+			typedef typename ft::bst_select<value_type, map_split_values<mapped_type>::value>::type	bst_type;
 			typedef bst_type*															bst_pointer;
 			typedef typename allocator_type::template rebind<bst_type>::other			bst_allocator;
 			typedef ft::map_iterator<value_type, bst_type>							iterator;
@@ -44,113 +58,262 @@ namespace ft
 			typedef size_t										size_type;
 
 		private:
+			typedef integral_constant<bool, map_split_values<mapped_type>::value>	split_tag;
+
 			/*variables*/
-			allocator_type	_allocator;
-			bst_allocator	_bst_allocator;
-			size_type		_size;
-			bst_pointer		_root;
-			key_compare		_comp;
+			allocator_type								_allocator;
+			bst_allocator								_bst_allocator;
+			size_type									_size;
+			bst_node									_header;
+			key_compare									_comp;
+			ft::slab_pool<value_type, allocator_type>	_values;
 
 			/*functions*/
-			bst_pointer		_bst_insert(bst_pointer bst, const value_type& val, bst_pointer parent = NULL)
+			bst_node*		_root() const
+			{
+				return (_header.left);
+			}
+
+			bst_node*		_end() const
+			{
+				return (const_cast<bst_node*>(&_header));
+			}
+
+			const key_type&	_key(bst_node* n) const
+			{
+				return (bst_key(static_cast<bst_pointer>(n)));
+			}
+
+			void			_bst_construct(bst_pointer bst, const value_type& val, bst_node* parent, integral_constant<bool, false>)
+			{
+				_bst_allocator.construct(bst, bst_type(val, NULL, NULL, parent));
+			}
+
+			void			_bst_construct(bst_pointer bst, const value_type& val, bst_node* parent, integral_constant<bool, true>)
+			{
+				pointer	v = _values.allocate();
+				_allocator.construct(v, val);
+				_bst_allocator.construct(bst, bst_type(v, NULL, NULL, parent));
+			}
+
+# if __cplusplus >= 201103L
+			void			_bst_construct(bst_pointer bst, value_type&& val, bst_node* parent, integral_constant<bool, false>)
+			{
+				_bst_allocator.construct(bst, bst_type(std::move(val), NULL, NULL, parent));
+			}
+
+			void			_bst_construct(bst_pointer bst, value_type&& val, bst_node* parent, integral_constant<bool, true>)
+			{
+				pointer	v = _values.allocate();
+				_allocator.construct(v, std::move(val));
+				_bst_allocator.construct(bst, bst_type(v, NULL, NULL, parent));
+			}
+
+# endif
+			void			_bst_release(bst_pointer, integral_constant<bool, false>)
+			{}
+
+			void			_bst_release(bst_pointer bst, integral_constant<bool, true>)
+			{
+				_allocator.destroy(bst->ref);
+				_values.deallocate(bst->ref);
+			}
+
+			void			_bst_destroy(bst_node* bst)
 			{
-				if (!bst)
+				_bst_release(static_cast<bst_pointer>(bst), split_tag());
+				_bst_allocator.destroy(static_cast<bst_pointer>(bst));
+				_bst_allocator.deallocate(static_cast<bst_pointer>(bst), 1);
+			}
+
+			bst_node*		_lower_bound(const key_type& k) const
+			{
+				bst_node*	bst = _root();
+				bst_node*	ret = _end();
+				while (bst)
 				{
-					bst = _bst_allocator.allocate(1);
-					_bst_allocator.construct(bst, bst_type(val, NULL, NULL, parent));
-					if (!_root)
-						_root = bst;
-					else if (key_comp()(parent->val.first, bst->val.first))
-						parent->right = bst;
+					if (!key_comp()(_key(bst), k))
+					{
+						ret = bst;
+						bst = bst->left;
+					}
 					else
-						parent->left = bst;
-					_size++;
+						bst = bst->right;
 				}
-				else if (key_comp()(val.first, bst->val.first))
-					return (_bst_insert(bst->left, val, bst));
-				else
-					return (_bst_insert(bst->right, val, bst));
+				return (ret);
+			}
+
+			bst_node*		_upper_bound(const key_type& k) const
+			{
+				bst_node*	bst = _root();
+				bst_node*	ret = _end();
+				while (bst)
+				{
+					if (key_comp()(k, _key(bst)))
+					{
+						ret = bst;
+						bst = bst->left;
+					}
+					else
+						bst = bst->right;
+				}
+				return (ret);
+			}
+
+			bst_node*		_find(const key_type& k) const
+			{
+				bst_node*	bst = _lower_bound(k);
+				if (bst == _end() || key_comp()(k, _key(bst)))
+					return (_end());
 				return (bst);
 			}
 
-			bst_pointer		_bst_erase(bst_pointer bst, const value_type& val)
+			/*link where k belongs, parent is set to its would-be parent; *link is set if k exists*/
+			bst_node**		_bst_link(const key_type& k, bst_node*& parent)
 			{
-				if (!bst)
-					return (bst);
-				else if (key_comp()(val.first, bst->val.first))
-					bst->left = _bst_erase(bst->left, val);
-				else if (key_comp()(bst->val.first, val.first))
-					bst->right = _bst_erase(bst->right, val);
-				else
+				bst_node**	link = &_header.left;
+				parent = _end();
+				while (*link)
 				{
-					if (!bst->left && !bst->right)
+					if (key_comp()(k, _key(*link)))
 					{
-						_bst_allocator.destroy(bst);
-						return (NULL);
+						parent = *link;
+						link = &parent->left;
 					}
-					else if (!bst->left)
+					else if (key_comp()(_key(*link), k))
 					{
-						bst_pointer	t = bst->right;
-						t->parent = bst->parent;
-						_bst_allocator.destroy(bst);
-						return (t);
+						parent = *link;
+						link = &parent->right;
 					}
-					else if (!bst->right)
+					else
+						break ;
+				}
+				return (link);
+			}
+
+			pair<bst_node*, bool>	_bst_insert(const value_type& val)
+			{
+				bst_node*	parent;
+				bst_node**	link = _bst_link(val.first, parent);
+				if (*link)
+					return (pair<bst_node*, bool>(*link, false));
+				bst_pointer	bst = _bst_allocator.allocate(1);
+				_bst_construct(bst, val, parent, split_tag());
+				*link = bst;
+				_size++;
+				return (pair<bst_node*, bool>(bst, true));
+			}
+# if __cplusplus >= 201103L
+
+			pair<bst_node*, bool>	_bst_insert(value_type&& val)
+			{
+				bst_node*	parent;
+				bst_node**	link = _bst_link(val.first, parent);
+				if (*link)
+					return (pair<bst_node*, bool>(*link, false));
+				bst_pointer	bst = _bst_allocator.allocate(1);
+				_bst_construct(bst, std::move(val), parent, split_tag());
+				*link = bst;
+				_size++;
+				return (pair<bst_node*, bool>(bst, true));
+			}
+# endif
+
+			void			_bst_transplant(bst_node* u, bst_node* v)
+			{
+				if (u == u->parent->left)
+					u->parent->left = v;
+				else
+					u->parent->right = v;
+				if (v)
+					v->parent = u->parent;
+			}
+
+			void			_bst_erase(bst_node* bst)
+			{
+				if (!bst->left)
+					_bst_transplant(bst, bst->right);
+				else if (!bst->right)
+					_bst_transplant(bst, bst->left);
+				else
+				{
+					bst_node*	t = smallest_leaf(bst->right);
+					if (t->parent != bst)
 					{
-						bst_pointer	t = bst->left;
-						t->parent = bst->parent;
-						_bst_allocator.destroy(bst);
-						return (t);
+						_bst_transplant(t, t->right);
+						t->right = bst->right;
+						t->right->parent = t;
 					}
-					bst_pointer	t = largest_leaf(bst->left);
-					bst_pointer	p = NULL;
-					if (bst->parent)
-						p = bst->parent;
-					bst_pointer	l = bst->left;
-					bst_pointer	r = bst->right;
-					_bst_allocator.destroy(bst);
-					_bst_allocator.construct(bst, bst_type(t->val, l, r, p));
-					bst->left = _bst_erase(bst->left, t->val);
+					_bst_transplant(bst, t);
+					t->left = bst->left;
+					t->left->parent = t;
 				}
-				return (bst);
+				_bst_destroy(bst);
+				_size--;
 			}
 
 		public:
 			/*MEMBER FUNCTIONS*/
 			explicit map(const key_compare& comp = key_compare(), const allocator_type& alloc = allocator_type()) :
 				_allocator(alloc),
+				_bst_allocator(alloc),
 				_size(0),
-				_root(NULL),
-				_comp(comp)
+				_header(),
+				_comp(comp),
+				_values(alloc)
 			{}
 
 			template<class InputIterator> map(InputIterator first, InputIterator last, const key_compare& comp = key_compare(), const allocator_type& alloc = allocator_type()) :
 				_allocator(alloc),
+				_bst_allocator(alloc),
 				_size(0),
-				_root(NULL),
-				_comp(comp)
+				_header(),
+				_comp(comp),
+				_values(alloc)
 			{
 				insert(first, last);
 			}
 
 			map(const map& x) :
 				_allocator(x._allocator),
-				_size(x._size),
-				_root(x._root),
-				_comp(x._comp)
+				_bst_allocator(x._allocator),
+				_size(0),
+				_header(),
+				_comp(x._comp),
+				_values(x._allocator)
+			{
+				insert(x.begin(), x.end());
+			}
+
+# if __cplusplus >= 201103L
+			map(map&& x) :
+				_allocator(x._allocator),
+				_bst_allocator(x._allocator),
+				_size(0),
+				_header(),
+				_comp(x._comp),
+				_values(x._allocator)
 			{
-				*this = x;
+				swap(x);
+			}
+
+			map&								operator=(map&& x)
+			{
+				clear();
+				swap(x);
+				return (*this);
 			}
 
+# endif
 			~map()
 			{
 				clear();
-				if (_root)
-					_bst_allocator.deallocate(_root, _size);
 			}
 
 			map&								operator=(const map& x)
 			{
+				if (this == &x)
+					return (*this);
 				clear();
 				insert(x.begin(), x.end());
 				return (*this);
@@ -159,22 +322,22 @@ namespace ft
 			/*iterators*/
 			iterator							begin()
 			{
-				return (iterator(smallest_leaf(_root), _root));
+				return (iterator(smallest_leaf(_end())));
 			}
 
 			const_iterator						begin() const
 			{
-				return (const_iterator(smallest_leaf(_root), _root));
+				return (const_iterator(smallest_leaf(_end())));
 			}
 
 			iterator							end()
 			{
-				return (iterator(NULL, _root));
+				return (iterator(_end()));
 			}
 
 			const_iterator						end() const
 			{
-				return (const_iterator(NULL, _root));
+				return (const_iterator(_end()));
 			}
 
 			reverse_iterator					rbegin()
@@ -210,9 +373,10 @@ namespace ft
 				return _size;
 			}
 
+			/*the largest difference_type, size_type(-1) >> 1, spread over the node footprint*/
 			size_type							max_size() const
 			{
-				return (std::numeric_limits<difference_type>::max() / (sizeof(ft::bst<mapped_type>) - ((((sizeof(ft::bst<mapped_type>) + 8) / 16) + 1) * 4)));
+				return ((static_cast<size_type>(-1) >> 1) / (sizeof(ft::bst<mapped_type>) - ((((sizeof(ft::bst<mapped_type>) + 8) / 16) + 1) * 4)));
 			}
 
 			/*element access*/
@@ -224,12 +388,23 @@ namespace ft
 			/*modifiers*/
 			pair<iterator, bool>				insert(const value_type& val)
 			{
-				iterator	it = find(val.first);
-				if (it != end())
-					return (pair<iterator, bool>(it, false));
-				return (pair<iterator, bool>(iterator(_bst_insert(_root, val), _root), true));
+				pair<bst_node*, bool>	ret = _bst_insert(val);
+				return (pair<iterator, bool>(iterator(ret.first), ret.second));
+			}
+
+# if __cplusplus >= 201103L
+			pair<iterator, bool>				insert(value_type&& val)
+			{
+				pair<bst_node*, bool>	ret = _bst_insert(std::move(val));
+				return (pair<iterator, bool>(iterator(ret.first), ret.second));
+			}
+
+			template<class... Args> pair<iterator, bool>	emplace(Args&&... args)
+			{
+				return (insert(value_type(std::forward<Args>(args)...)));
 			}
 
+# endif
 			iterator							insert(iterator position, const value_type& val)
 			{
 				(void)position;
@@ -244,16 +419,15 @@ namespace ft
 
 			void								erase(iterator position)
 			{
-				erase(position->first);
+				_bst_erase(position.node());
 			}
 
 			size_type							erase(const key_type& k)
 			{
 				iterator	it = find(k);
-				if (!_root || it == end())
+				if (it == end())
 					return (0);
-				_size--;
-				_root = _bst_erase(_root, value_type(k, it->second));
+				_bst_erase(it.node());
 				return (1);
 			}
 
@@ -268,28 +442,50 @@ namespace ft
 				allocator_type	a = x._allocator;
 				bst_allocator	b = x._bst_allocator;
 				size_type		s = x._size;
-				bst_pointer		r = x._root;
+				bst_node*		r = x._header.left;
 				key_compare		c = x._comp;
 
 				x._allocator = _allocator;
 				x._bst_allocator = _bst_allocator;
 				x._size = _size;
-				x._root = _root;
+				x._header.left = _header.left;
 				x._comp = _comp;
 
 				_allocator = a;
 				_bst_allocator = b;
 				_size = s;
-				_root = r;
+				_header.left = r;
 				_comp = c;
+
+				if (_header.left)
+					_header.left->parent = &_header;
+				if (x._header.left)
+					x._header.left->parent = &x._header;
+				_values.swap(x._values);
 			}
 
 			void								clear()
 			{
-				for (size_type i = 0; i < _size; i++)
-					_bst_allocator.destroy(_root);
+				bst_node*	bst = _root();
+				while (bst)
+				{
+					if (bst->left)
+						bst = bst->left;
+					else if (bst->right)
+						bst = bst->right;
+					else
+					{
+						bst_node*	p = bst->parent;
+						if (p->left == bst)
+							p->left = NULL;
+						else
+							p->right = NULL;
+						_bst_destroy(bst);
+						bst = (p == _end()) ? NULL : p;
+					}
+				}
 				_size = 0;
-				_root = NULL;
+				_values.release();
 			}
 
 			/*observers*/
@@ -306,90 +502,37 @@ namespace ft
 			/*operations*/
 			iterator							find(const key_type& k)
 			{
-				iterator	it = begin();
-				while (it != end())
-				{
-					if (!key_comp()(it->first, k) && !key_comp()(k, it->first))
-						break ;
-					it++;
-				}
-				return (it);
+				return (iterator(_find(k)));
 			}
 
 			const_iterator						find(const key_type& k) const
 			{
-				const_iterator	it = begin();
-				while (it != end())
-				{
-					if (!key_comp()(it->first, k) && !key_comp()(k, it->first))
-						break ;
-					it++;
-				}
-				return (it);
+				return (const_iterator(_find(k)));
 			}
 
 			size_type							count(const key_type& k) const
 			{
-				if (!_root)
-					return (0);
-				const_iterator	it = begin();
-				if (!key_comp()(it->first, k) && !key_comp()(k, it->first))
-					return (1);
-				while (it != end())
-				{
-					if (!key_comp()(it->first, k) && !key_comp()(k, it->first))
-						return (1);
-					it++;
-				}
-				return (0);
+				return (_find(k) != _end());
 			}
 
 			iterator							lower_bound(const key_type& k)
 			{
-				iterator	it = begin();
-				while (it != end())
-				{
-					if (!key_comp()(it->first, k))
-						break ;
-					it++;
-				}
-				return (it);
+				return (iterator(_lower_bound(k)));
 			}
 
 			const_iterator						lower_bound(const key_type& k) const
 			{
-				const_iterator	it = begin();
-				while (it != end())
-				{
-					if (!key_comp()(it->first, k))
-						break ;
-					it++;
-				}
-				return (it);
+				return (const_iterator(_lower_bound(k)));
 			}
 
 			iterator							upper_bound(const key_type& k)
 			{
-				iterator	it = begin();
-				while (it != end())
-				{
-					if (key_comp()(k, it->first))
-						break ;
-					it++;
-				}
-				return (it);
+				return (iterator(_upper_bound(k)));
 			}
 
 			const_iterator						upper_bound(const key_type& k) const
 			{
-				const_iterator	it = begin();
-				while (it != end())
-				{
-					if (key_comp()(k, it->first))
-						break ;
-					it++;
-				}
-				return (it);
+				return (const_iterator(_upper_bound(k)));
 			}
 
 			pair<const_iterator, const_iterator>equal_range(const key_type& k) const
@@ -0,0 +1,255 @@
+#ifndef MMAP_MAP_HPP
+# define MMAP_MAP_HPP
+
+# include <cstdio>
+# include <cstring>
+# include <stdexcept>
+# include <string>
+# include <fcntl.h>
+# include <unistd.h>
+# include <sys/mman.h>
+# include <sys/stat.h>
+# include "utils.hpp"
+# include "map.hpp"
+
+namespace ft
+{
+	/*
+	** Read-only ordered map backed by a memory-mapped file image.
+	** The image is a fixed header followed by the map's value_type records in
+	** key order, so the sorted array is the (implicit) search tree and nothing
+	** has to be rebuilt on open: pages are faulted in on first access and can
+	** be shared between processes. Key and T must be trivially copyable and
+	** must not hold pointers for the image to stay position independent.
+	*/
+	template<class Key, class T, class Compare = std::less<Key> > class	mmap_map
+	{
+		public:
+			/*MEMBER TYPES*/
+			typedef Key										key_type;
+			typedef T										mapped_type;
+			typedef ft::pair<const key_type, mapped_type>	value_type;
+			typedef Compare									key_compare;
+			typedef const value_type&						reference;
+			typedef const value_type&						const_reference;
+			typedef const value_type*						pointer;
+			typedef const value_type*						const_pointer;
+			typedef ft::vector_iterator<const value_type>	iterator;
+			typedef ft::vector_iterator<const value_type>	const_iterator;
+			typedef ft::reverse_iterator<iterator>			reverse_iterator;
+			typedef ft::reverse_iterator<const_iterator>	const_reverse_iterator;
+			typedef ptrdiff_t								difference_type;
+			typedef size_t									size_type;
+
+		private:
+			/*records are written and mapped back as raw bytes*/
+			typedef char	_trivial_check[sizeof(static_check<is_trivially_copyable<key_type>::value
+				&& is_trivially_copyable<mapped_type>::value>)];
+
+			/*image header, padded so the records keep their alignment*/
+			struct											header
+			{
+				char		magic[8];
+				size_type	key_size;
+				size_type	mapped_size;
+				size_type	value_size;
+				size_type	count;
+				char		pad[64 - 8 - 4 * sizeof(size_type)];
+			};
+
+			/*variables*/
+			void*				_image;
+			size_type			_length;
+			const value_type*	_begin;
+			size_type			_size;
+			key_compare			_comp;
+
+			/*functions*/
+			static const char*	_magic()
+			{
+				return ("FTMAP01");
+			}
+
+			const value_type*	_lower_bound(const key_type& k) const
+			{
+				const value_type*	first = _begin;
+				size_type			n = _size;
+				while (n > 0)
+				{
+					size_type	half = n / 2;
+					if (_comp(first[half].first, k))
+					{
+						first += half + 1;
+						n -= half + 1;
+					}
+					else
+						n = half;
+				}
+				return (first);
+			}
+
+			const value_type*	_upper_bound(const key_type& k) const
+			{
+				const value_type*	first = _begin;
+				size_type			n = _size;
+				while (n > 0)
+				{
+					size_type	half = n / 2;
+					if (!_comp(k, first[half].first))
+					{
+						first += half + 1;
+						n -= half + 1;
+					}
+					else
+						n = half;
+				}
+				return (first);
+			}
+
+			mmap_map(const mmap_map&);
+			mmap_map&			operator=(const mmap_map&);
+
+		public:
+			/*MEMBER FUNCTIONS*/
+			explicit							mmap_map(const char* path, const key_compare& comp = key_compare()) :
+				_image(NULL),
+				_length(0),
+				_begin(NULL),
+				_size(0),
+				_comp(comp)
+			{
+				int			fd = ::open(path, O_RDONLY);
+				struct stat	st;
+				if (fd < 0)
+					throw std::runtime_error(std::string("mmap_map: cannot open ") + path);
+				if (::fstat(fd, &st) < 0 || static_cast<size_type>(st.st_size) < sizeof(header))
+				{
+					::close(fd);
+					throw std::runtime_error(std::string("mmap_map: bad image ") + path);
+				}
+				_length = st.st_size;
+				_image = ::mmap(NULL, _length, PROT_READ, MAP_SHARED, fd, 0);
+				::close(fd);
+				if (_image == MAP_FAILED)
+					throw std::runtime_error(std::string("mmap_map: cannot map ") + path);
+				const header*	h = static_cast<const header*>(_image);
+				if (std::memcmp(h->magic, _magic(), sizeof(h->magic)) || h->key_size != sizeof(key_type)
+					|| h->mapped_size != sizeof(mapped_type) || h->value_size != sizeof(value_type)
+					|| h->count > (_length - sizeof(header)) / sizeof(value_type))
+				{
+					::munmap(_image, _length);
+					throw std::runtime_error(std::string("mmap_map: incompatible image ") + path);
+				}
+				_size = h->count;
+				_begin = reinterpret_cast<const value_type*>(h + 1);
+			}
+
+			~mmap_map()
+			{
+				if (_image)
+					::munmap(_image, _length);
+			}
+
+			/*serialization*/
+			template<class Alloc> static void	write(const ft::map<Key, T, Compare, Alloc>& m, const char* path)
+			{
+				std::string	tmp = std::string(path) + ".tmp";
+				std::FILE*	f = std::fopen(tmp.c_str(), "wb");
+				header		h;
+				if (!f)
+					throw std::runtime_error("mmap_map: cannot create " + tmp);
+				std::memset(&h, 0, sizeof(h));
+				std::memcpy(h.magic, _magic(), sizeof(h.magic));
+				h.key_size = sizeof(key_type);
+				h.mapped_size = sizeof(mapped_type);
+				h.value_size = sizeof(value_type);
+				h.count = m.size();
+				bool	ok = std::fwrite(&h, sizeof(h), 1, f) == 1;
+				for (typename ft::map<Key, T, Compare, Alloc>::const_iterator it = m.begin(); ok && it != m.end(); ++it)
+					ok = std::fwrite(&(*it), sizeof(value_type), 1, f) == 1;
+				if (std::fclose(f) != 0 || !ok || std::rename(tmp.c_str(), path) != 0)
+				{
+					std::remove(tmp.c_str());
+					throw std::runtime_error(std::string("mmap_map: cannot write ") + path);
+				}
+			}
+
+			/*iterators*/
+			const_iterator						begin() const
+			{
+				return (const_iterator(_begin));
+			}
+
+			const_iterator						end() const
+			{
+				return (const_iterator(_begin + _size));
+			}
+
+			const_reverse_iterator				rbegin() const
+			{
+				return (const_reverse_iterator(end()));
+			}
+
+			const_reverse_iterator				rend() const
+			{
+				return (const_reverse_iterator(begin()));
+			}
+
+			/*capacity*/
+			bool								empty() const
+			{
+				return (_size == 0);
+			}
+
+			size_type							size() const
+			{
+				return (_size);
+			}
+
+			/*element access*/
+			const mapped_type&					at(const key_type& k) const
+			{
+				const_iterator	it = find(k);
+				if (it == end())
+					throw std::out_of_range("OOB");
+				return (it->second);
+			}
+
+			/*observers*/
+			key_compare							key_comp() const
+			{
+				return (_comp);
+			}
+
+			/*operations*/
+			const_iterator						find(const key_type& k) const
+			{
+				const value_type*	p = _lower_bound(k);
+				if (p == _begin + _size || _comp(k, p->first))
+					return (end());
+				return (const_iterator(p));
+			}
+
+			size_type							count(const key_type& k) const
+			{
+				return (find(k) != end());
+			}
+
+			const_iterator						lower_bound(const key_type& k) const
+			{
+				return (const_iterator(_lower_bound(k)));
+			}
+
+			const_iterator						upper_bound(const key_type& k) const
+			{
+				return (const_iterator(_upper_bound(k)));
+			}
+
+			pair<const_iterator, const_iterator>equal_range(const key_type& k) const
+			{
+				return (pair<const_iterator, const_iterator>(lower_bound(k), upper_bound(k)));
+			}
+	};
+}
+
+#endif
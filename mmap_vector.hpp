@@ -0,0 +1,494 @@
+#ifndef MMAP_VECTOR_HPP
+# define MMAP_VECTOR_HPP
+
+# include <cstring>
+# include <limits>
+# include <stdexcept>
+# include <string>
+# include <fcntl.h>
+# include <unistd.h>
+# include <sys/mman.h>
+# include <sys/stat.h>
+# include "utils.hpp"
+# include "vector.hpp"
+
+namespace ft
+{
+	/*
+	** Vector whose storage is a shared mapping of a file: a fixed header
+	** followed by the elements, so the page cache decides what stays in
+	** memory and the contents outlive the process. Growth extends the file
+	** with ftruncate and the mapping with mremap. The element count is
+	** written to the header on sync(), on growth and on close, when the
+	** file is also cut back to the elements in use. T must be trivially
+	** copyable and must not hold pointers.
+	*/
+	template<class T> class										mmap_vector
+	{
+		public:
+			/*MEMBER TYPES*/
+			typedef T										value_type;
+			typedef T&										reference;
+			typedef const T&								const_reference;
+			typedef T*										pointer;
+			typedef const T*								const_pointer;
+			typedef ft::vector_iterator<value_type>			iterator;
+			typedef ft::vector_iterator<const value_type>	const_iterator;
+			typedef ft::reverse_iterator<iterator>			reverse_iterator;
+			typedef ft::reverse_iterator<const_iterator>	const_reverse_iterator;
+			typedef ptrdiff_t								difference_type;
+			typedef size_t									size_type;
+
+			/*access pattern hints, passed to madvise*/
+			enum											access
+			{
+				ACCESS_NORMAL,
+				ACCESS_SEQUENTIAL,
+				ACCESS_RANDOM
+			};
+
+		private:
+			/*elements are memmoved and stored as raw file bytes*/
+			typedef char	_trivial_check[sizeof(static_check<is_trivially_copyable<value_type>::value>)];
+
+			/*file header, padded so the elements keep their alignment*/
+			struct											header
+			{
+				char		magic[8];
+				size_type	value_size;
+				size_type	count;
+				char		pad[64 - 8 - 2 * sizeof(size_type)];
+			};
+
+			/*variables*/
+			int				_fd;
+			std::string		_path;
+			header*			_head;
+			size_type		_length;
+			pointer			_begin;
+			pointer			_end;
+			size_type		_capacity;
+			access			_access;
+
+			/*functions*/
+			static const char*	_magic()
+			{
+				return ("FTVEC01");
+			}
+
+			static size_type	_page()
+			{
+				static size_type	page = static_cast<size_type>(::sysconf(_SC_PAGESIZE));
+				return (page);
+			}
+
+			/*file length holding n elements, rounded up to whole pages*/
+			static size_type	_length_for(size_type n)
+			{
+				return ((sizeof(header) + n * sizeof(value_type) + _page() - 1) & ~(_page() - 1));
+			}
+
+			void				_fail(const char* what) const
+			{
+				throw std::runtime_error(std::string("mmap_vector: ") + what + " " + _path);
+			}
+
+			void				_advise()
+			{
+				int	advice = MADV_NORMAL;
+				if (_access == ACCESS_SEQUENTIAL)
+					advice = MADV_SEQUENTIAL;
+				else if (_access == ACCESS_RANDOM)
+					advice = MADV_RANDOM;
+				::madvise(_head, _length, advice);
+			}
+
+			/*resizes the file to length bytes and maps all of it*/
+			void				_map(size_type length)
+			{
+				size_type	count = size();
+				void*		p;
+
+				if (::ftruncate(_fd, static_cast<off_t>(length)) < 0)
+					_fail("cannot resize");
+				if (!_head)
+					p = ::mmap(NULL, length, PROT_READ | PROT_WRITE, MAP_SHARED, _fd, 0);
+				else
+				{
+					_head->count = count;
+# ifdef MREMAP_MAYMOVE
+					p = ::mremap(_head, _length, length, MREMAP_MAYMOVE);
+# else
+					::munmap(_head, _length);
+					_head = NULL;
+					p = ::mmap(NULL, length, PROT_READ | PROT_WRITE, MAP_SHARED, _fd, 0);
+# endif
+				}
+				if (p == MAP_FAILED)
+				{
+					if (!_head)
+					{
+						_begin = NULL;
+						_end = NULL;
+						_capacity = 0;
+					}
+					_fail("cannot map");
+				}
+				_head = static_cast<header*>(p);
+				_length = length;
+				_begin = reinterpret_cast<pointer>(_head + 1);
+				_end = _begin + count;
+				_capacity = (length - sizeof(header)) / sizeof(value_type);
+				_advise();
+			}
+
+			void				_grow(size_type n)
+			{
+				size_type	c = static_cast<size_type>(_capacity * FT_VECTOR_GROWTH);
+
+				if (n <= _capacity)
+					return ;
+				if (n > max_size())
+					throw std::length_error("L");
+				_map(_length_for(c < n || c > max_size() ? n : c));
+			}
+
+			/*opens room for n elements at p, returns the (possibly moved) p*/
+			pointer				_make_gap(pointer p, size_type n)
+			{
+				size_type	i = p - _begin;
+
+				_grow(size() + n);
+				p = _begin + i;
+				std::memmove(static_cast<void*>(p + n), static_cast<const void*>(p), (_end - p) * sizeof(value_type));
+				_end += n;
+				return (p);
+			}
+
+			void				_close()
+			{
+				if (_head)
+				{
+					size_type	count = size();
+					_head->count = count;
+					::munmap(_head, _length);
+					int	r = ::ftruncate(_fd, static_cast<off_t>(sizeof(header) + count * sizeof(value_type)));
+					(void)r;
+				}
+				if (_fd >= 0)
+					::close(_fd);
+				_head = NULL;
+				_fd = -1;
+			}
+
+			mmap_vector(const mmap_vector&);
+			mmap_vector&		operator=(const mmap_vector&);
+
+		public:
+			/*MEMBER FUNCTIONS*/
+			/*opens path, creating an empty vector if it does not exist*/
+			explicit							mmap_vector(const char* path, access a = ACCESS_NORMAL) :
+				_fd(-1),
+				_path(path),
+				_head(NULL),
+				_length(0),
+				_begin(NULL),
+				_end(NULL),
+				_capacity(0),
+				_access(a)
+			{
+				struct stat	st;
+				header		h;
+				size_type	count = 0;
+
+				_fd = ::open(path, O_RDWR | O_CREAT, 0644);
+				if (_fd < 0)
+					_fail("cannot open");
+				try
+				{
+					if (::fstat(_fd, &st) < 0)
+						_fail("cannot stat");
+					if (st.st_size > 0)
+					{
+						if (::pread(_fd, &h, sizeof(h), 0) != static_cast<ssize_t>(sizeof(h))
+							|| std::memcmp(h.magic, _magic(), sizeof(h.magic)) || h.value_size != sizeof(value_type)
+							|| h.count > (static_cast<size_type>(st.st_size) - sizeof(header)) / sizeof(value_type))
+							_fail("incompatible file");
+						count = h.count;
+					}
+					_map(_length_for(count));
+				}
+				catch (...)
+				{
+					_close();
+					throw;
+				}
+				if (!st.st_size)
+				{
+					std::memset(static_cast<void*>(_head), 0, sizeof(header));
+					std::memcpy(_head->magic, _magic(), sizeof(_head->magic));
+					_head->value_size = sizeof(value_type);
+				}
+				_end = _begin + count;
+			}
+
+			~mmap_vector()
+			{
+				_close();
+			}
+
+			const std::string&					path() const
+			{
+				return (_path);
+			}
+
+			/*writes the element count and flushes the dirty pages to the file*/
+			void								sync()
+			{
+				_head->count = size();
+				if (::msync(_head, sizeof(header) + size() * sizeof(value_type), MS_SYNC) < 0)
+					_fail("cannot sync");
+			}
+
+			/*sets the madvise hint for the whole mapping, kept across growth*/
+			void								advise(access a)
+			{
+				_access = a;
+				_advise();
+			}
+
+			/*iterators*/
+			iterator							begin()
+			{
+				return (iterator(_begin));
+			}
+
+			const_iterator						begin() const
+			{
+				return (const_iterator(_begin));
+			}
+
+			iterator							end()
+			{
+				return (iterator(_end));
+			}
+
+			const_iterator						end() const
+			{
+				return (const_iterator(_end));
+			}
+
+			reverse_iterator					rbegin()
+			{
+				return (reverse_iterator(end()));
+			}
+
+			const_reverse_iterator				rbegin() const
+			{
+				return (const_reverse_iterator(end()));
+			}
+
+			reverse_iterator					rend()
+			{
+				return (reverse_iterator(begin()));
+			}
+
+			const_reverse_iterator				rend() const
+			{
+				return (const_reverse_iterator(begin()));
+			}
+
+			/*capacity*/
+			size_type							size() const
+			{
+				return (_end - _begin);
+			}
+
+			size_type							max_size() const
+			{
+				return ((static_cast<size_type>(std::numeric_limits<off_t>::max()) - sizeof(header) - _page()) / sizeof(value_type));
+			}
+
+			size_type							capacity() const
+			{
+				return (_capacity);
+			}
+
+			bool								empty() const
+			{
+				return (_begin == _end);
+			}
+
+			void								reserve(size_type n)
+			{
+				if (n > max_size())
+					throw std::length_error("L");
+				if (n > _capacity)
+					_map(_length_for(n));
+			}
+
+			void								resize(size_type n, value_type val = value_type())
+			{
+				if (n > size())
+				{
+					_grow(n);
+					while (_end != _begin + n)
+						*_end++ = val;
+				}
+				else
+					_end = _begin + n;
+			}
+
+			/*cuts the file back to the pages holding the elements*/
+			void								shrink_to_fit()
+			{
+				if (_length_for(size()) < _length)
+					_map(_length_for(size()));
+			}
+
+			/*element access*/
+			reference							operator[](size_type n)
+			{
+				return (_begin[n]);
+			}
+
+			const_reference						operator[](size_type n) const
+			{
+				return (_begin[n]);
+			}
+
+			reference							at(size_type n)
+			{
+				if (n >= size())
+					throw std::out_of_range("OOB");
+				return (_begin[n]);
+			}
+
+			const_reference						at(size_type n) const
+			{
+				if (n >= size())
+					throw std::out_of_range("OOB");
+				return (_begin[n]);
+			}
+
+			reference							front()
+			{
+				return (*_begin);
+			}
+
+			const_reference						front() const
+			{
+				return (*_begin);
+			}
+
+			reference							back()
+			{
+				return (*(_end - 1));
+			}
+
+			const_reference						back() const
+			{
+				return (*(_end - 1));
+			}
+
+			pointer								data()
+			{
+				return (_begin);
+			}
+
+			const_pointer						data() const
+			{
+				return (_begin);
+			}
+
+			/*modifiers*/
+			void								assign(size_type n, const value_type& val)
+			{
+				value_type	t(val);
+				clear();
+				resize(n, t);
+			}
+
+			void								push_back(const value_type& val)
+			{
+				if (size() == _capacity)
+				{
+					value_type	t(val);
+					_grow(size() + 1);
+					*_end++ = t;
+					return ;
+				}
+				*_end++ = val;
+			}
+
+			void								pop_back()
+			{
+				_end--;
+			}
+
+			iterator							insert(iterator position, const value_type& val)
+			{
+				value_type	t(val);
+				pointer		p = _make_gap(&(*position), 1);
+				*p = t;
+				return (iterator(p));
+			}
+
+			void								insert(iterator position, size_type n, const value_type& val)
+			{
+				value_type	t(val);
+				pointer		p = _make_gap(&(*position), n);
+				for (size_type i = 0; i < n; i++)
+					p[i] = t;
+			}
+
+			iterator							erase(iterator position)
+			{
+				return (erase(position, position + 1));
+			}
+
+			iterator							erase(iterator first, iterator last)
+			{
+				pointer	f = &(*first);
+				pointer	l = &(*last);
+				std::memmove(static_cast<void*>(f), static_cast<const void*>(l), (_end - l) * sizeof(value_type));
+				_end -= l - f;
+				return (first);
+			}
+
+			void								swap(mmap_vector& x)
+			{
+				int			fd = x._fd;
+				header*		head = x._head;
+				size_type	length = x._length;
+				pointer		b = x._begin;
+				pointer		e = x._end;
+				size_type	c = x._capacity;
+				access		a = x._access;
+
+				x._fd = _fd;
+				x._head = _head;
+				x._length = _length;
+				x._begin = _begin;
+				x._end = _end;
+				x._capacity = _capacity;
+				x._access = _access;
+				x._path.swap(_path);
+
+				_fd = fd;
+				_head = head;
+				_length = length;
+				_begin = b;
+				_end = e;
+				_capacity = c;
+				_access = a;
+			}
+
+			void								clear()
+			{
+				_end = _begin;
+			}
+	};
+}
+
+#endif
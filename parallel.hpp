@@ -0,0 +1,612 @@
+#ifndef PARALLEL_HPP
+# define PARALLEL_HPP
+
+# include <cstddef>
+# include <algorithm>
+# include <functional>
+# include <numeric>
+# include <stdexcept>
+# include <pthread.h>
+# include <sched.h>
+# include <unistd.h>
+# include "utils.hpp"
+# include "vector.hpp"
+
+/*
+** Ranges shorter than this many elements run serially on the caller: below
+** it, waking the workers costs more than the work they would share.
+*/
+# ifndef FT_PAR_CUTOFF
+#  define FT_PAR_CUTOFF 32768
+# endif
+
+/*
+** Chunks handed out per thread, so one slow chunk does not leave the other
+** threads idle at the end of a job.
+*/
+# ifndef FT_PAR_CHUNKS_PER_THREAD
+#  define FT_PAR_CHUNKS_PER_THREAD 4
+# endif
+
+namespace ft
+{
+	namespace par
+	{
+		/***************/
+		/* THREAD POOL */
+		/***************/
+
+		/*
+		** Fixed set of worker threads running one job at a time. A job is
+		** split in chunks numbered 0..chunks-1 which the workers and the
+		** calling thread take in turn from a shared counter. A run started
+		** while another one is in flight (a nested call, or a second user
+		** thread) executes serially on its caller.
+		*/
+		class							thread_pool
+		{
+			public:
+				/*MEMBER TYPES*/
+				typedef void	(*job_type)(void*, size_t);
+
+			private:
+				/*variables*/
+				pthread_mutex_t	_lock;
+				pthread_cond_t	_wake;
+				pthread_cond_t	_done;
+				pthread_t*		_threads;
+				size_t			_count;
+				job_type		_job;
+				void*			_ctx;
+				size_t			_chunks;
+				size_t			_next;
+				size_t			_running;
+				unsigned long	_generation;
+				unsigned long	_base;
+				bool			_stop;
+				bool			_failed;
+				int				_active;
+
+				thread_pool(const thread_pool&);
+				thread_pool&	operator=(const thread_pool&);
+
+				/*functions*/
+				void			_drain()
+				{
+					size_t	i;
+
+					try
+					{
+						while ((i = __sync_fetch_and_add(&_next, 1)) < _chunks)
+							_job(_ctx, i);
+					}
+					catch (...)
+					{
+						__sync_fetch_and_add(&_next, _chunks);
+						throw;
+					}
+				}
+
+				static void*	_worker(void* arg)
+				{
+					thread_pool*	pool = static_cast<thread_pool*>(arg);
+					unsigned long	seen;
+
+					pthread_mutex_lock(&pool->_lock);
+					seen = pool->_base;
+					while (true)
+					{
+						while (!pool->_stop && pool->_generation == seen)
+							pthread_cond_wait(&pool->_wake, &pool->_lock);
+						if (pool->_stop)
+							break ;
+						seen = pool->_generation;
+						pthread_mutex_unlock(&pool->_lock);
+						bool	ok = true;
+						try
+						{
+							pool->_drain();
+						}
+						catch (...)
+						{
+							ok = false;
+						}
+						pthread_mutex_lock(&pool->_lock);
+						if (!ok)
+							pool->_failed = true;
+						if (--pool->_running == 0)
+							pthread_cond_signal(&pool->_done);
+					}
+					pthread_mutex_unlock(&pool->_lock);
+					return (NULL);
+				}
+
+				/*waits for the workers to leave the current job, true if one threw*/
+				bool			_finish()
+				{
+					bool	failed;
+
+					pthread_mutex_lock(&_lock);
+					while (_running)
+						pthread_cond_wait(&_done, &_lock);
+					failed = _failed;
+					pthread_mutex_unlock(&_lock);
+					__sync_lock_release(&_active);
+					return (failed);
+				}
+
+				void			_start(size_t workers)
+				{
+					_stop = false;
+					_count = 0;
+					_base = _generation;
+					if (!workers)
+						return ;
+					_threads = new pthread_t[workers];
+					while (_count < workers && pthread_create(&_threads[_count], NULL, &_worker, this) == 0)
+						_count++;
+				}
+
+				void			_join()
+				{
+					pthread_mutex_lock(&_lock);
+					_stop = true;
+					pthread_cond_broadcast(&_wake);
+					pthread_mutex_unlock(&_lock);
+					for (size_t i = 0; i < _count; i++)
+						pthread_join(_threads[i], NULL);
+					delete[] _threads;
+					_threads = NULL;
+					_count = 0;
+				}
+
+			public:
+				/*MEMBER FUNCTIONS*/
+				/*n threads in total, the calling one included*/
+				explicit thread_pool(size_t n) :
+					_threads(NULL),
+					_count(0),
+					_job(NULL),
+					_ctx(NULL),
+					_chunks(0),
+					_next(0),
+					_running(0),
+					_generation(0),
+					_base(0),
+					_stop(false),
+					_failed(false),
+					_active(0)
+				{
+					pthread_mutex_init(&_lock, NULL);
+					pthread_cond_init(&_wake, NULL);
+					pthread_cond_init(&_done, NULL);
+					_start(n > 1 ? n - 1 : 0);
+				}
+
+				~thread_pool()
+				{
+					_join();
+					pthread_cond_destroy(&_done);
+					pthread_cond_destroy(&_wake);
+					pthread_mutex_destroy(&_lock);
+				}
+
+				size_t			size() const
+				{
+					return (_count + 1);
+				}
+
+				/*restarts the pool with n threads, waiting for a running job first*/
+				void			resize(size_t n)
+				{
+					while (!__sync_bool_compare_and_swap(&_active, 0, 1))
+						sched_yield();
+					_join();
+					_start(n > 1 ? n - 1 : 0);
+					__sync_lock_release(&_active);
+				}
+
+				/*
+				** Calls job(ctx, i) for every i < chunks and returns once all
+				** of them are done. An exception thrown on the calling thread
+				** is rethrown as is; one thrown on a worker cannot cross
+				** threads in C++98 and surfaces as std::runtime_error. Either
+				** way the chunks not yet started are skipped.
+				*/
+				void			run(job_type job, void* ctx, size_t chunks)
+				{
+					if (_count == 0 || chunks < 2 || !__sync_bool_compare_and_swap(&_active, 0, 1))
+					{
+						for (size_t i = 0; i < chunks; i++)
+							job(ctx, i);
+						return ;
+					}
+					pthread_mutex_lock(&_lock);
+					_job = job;
+					_ctx = ctx;
+					_chunks = chunks;
+					_next = 0;
+					_running = _count;
+					_failed = false;
+					++_generation;
+					pthread_cond_broadcast(&_wake);
+					pthread_mutex_unlock(&_lock);
+					try
+					{
+						_drain();
+					}
+					catch (...)
+					{
+						_finish();
+						throw;
+					}
+					if (_finish())
+						throw std::runtime_error("PAR");
+				}
+		};
+
+		inline size_t					hardware_threads()
+		{
+			long	n = ::sysconf(_SC_NPROCESSORS_ONLN);
+			return (n > 0 ? static_cast<size_t>(n) : 1);
+		}
+
+		inline thread_pool&				pool()
+		{
+			static thread_pool	p(hardware_threads());
+			return (p);
+		}
+
+		/*threads the algorithms below spread over, the caller included*/
+		inline size_t					threads()
+		{
+			return (pool().size());
+		}
+
+		/*0 picks one thread per online CPU*/
+		inline void						set_threads(size_t n)
+		{
+			pool().resize(n ? n : hardware_threads());
+		}
+
+		/************/
+		/* CHUNKING */
+		/************/
+
+		/*chunks a range of n elements is split into, 1 below the cutoff*/
+		inline size_t					chunk_count(size_t n)
+		{
+			size_t	grain = FT_PAR_CUTOFF / FT_PAR_CHUNKS_PER_THREAD;
+			size_t	chunks = threads() * FT_PAR_CHUNKS_PER_THREAD;
+
+			if (n < FT_PAR_CUTOFF || threads() < 2)
+				return (1);
+			if (grain && n / grain < chunks)
+				chunks = n / grain;
+			return (chunks ? chunks : 1);
+		}
+
+		/*first element of chunk i when n elements are split in chunks*/
+		inline size_t					chunk_begin(size_t n, size_t chunks, size_t i)
+		{
+			return (n / chunks * i + (i < n % chunks ? i : n % chunks));
+		}
+
+		/*******************************/
+		/* FOR_EACH, TRANSFORM, REDUCE */
+		/*******************************/
+
+		template<class It, class Function> struct				for_each_job
+		{
+			It			first;
+			size_t		n;
+			size_t		chunks;
+			Function	f;
+
+			static void	run(void* p, size_t i)
+			{
+				for_each_job&	j = *static_cast<for_each_job*>(p);
+				std::for_each(j.first + chunk_begin(j.n, j.chunks, i), j.first + chunk_begin(j.n, j.chunks, i + 1), j.f);
+			}
+		};
+
+		/*every chunk works on its own copy of f*/
+		template<class RandomIt, class Function> void			for_each(RandomIt first, RandomIt last, Function f)
+		{
+			for_each_job<RandomIt, Function>	job = {first, static_cast<size_t>(last - first), chunk_count(last - first), f};
+			pool().run(&job.run, &job, job.chunks);
+		}
+
+		template<class It, class OutIt, class UnaryOperation> struct	transform_job
+		{
+			It				first;
+			OutIt			d_first;
+			size_t			n;
+			size_t			chunks;
+			UnaryOperation	op;
+
+			static void	run(void* p, size_t i)
+			{
+				transform_job&	j = *static_cast<transform_job*>(p);
+				size_t			b = chunk_begin(j.n, j.chunks, i);
+				std::transform(j.first + b, j.first + chunk_begin(j.n, j.chunks, i + 1), j.d_first + b, j.op);
+			}
+		};
+
+		template<class RandomIt, class OutIt, class UnaryOperation> OutIt	transform(RandomIt first, RandomIt last, OutIt d_first, UnaryOperation op)
+		{
+			transform_job<RandomIt, OutIt, UnaryOperation>	job = {first, d_first, static_cast<size_t>(last - first), chunk_count(last - first), op};
+			pool().run(&job.run, &job, job.chunks);
+			return (d_first + job.n);
+		}
+
+		/*totals[i] = op-fold of chunk i, left to right*/
+		template<class It, class T, class BinaryOperation> struct	fold_job
+		{
+			It				first;
+			size_t			n;
+			size_t			chunks;
+			BinaryOperation	op;
+			T*				totals;
+
+			static void	run(void* p, size_t i)
+			{
+				fold_job&	j = *static_cast<fold_job*>(p);
+				It			it = j.first + chunk_begin(j.n, j.chunks, i);
+				It			end = j.first + chunk_begin(j.n, j.chunks, i + 1);
+				T			acc = *it;
+
+				while (++it != end)
+					acc = j.op(acc, *it);
+				j.totals[i] = acc;
+			}
+		};
+
+		/*
+		** op must be associative: chunks are folded separately, then their
+		** results are folded in order onto init.
+		*/
+		template<class RandomIt, class T, class BinaryOperation> T	reduce(RandomIt first, RandomIt last, T init, BinaryOperation op)
+		{
+			size_t	chunks = chunk_count(last - first);
+
+			if (chunks < 2)
+				return (std::accumulate(first, last, init, op));
+			ft::vector<T>	totals(chunks, init);
+			fold_job<RandomIt, T, BinaryOperation>	job = {first, static_cast<size_t>(last - first), chunks, op, &totals[0]};
+			pool().run(&job.run, &job, chunks);
+			for (size_t i = 0; i < chunks; i++)
+				init = op(init, totals[i]);
+			return (init);
+		}
+
+		template<class RandomIt, class T> T						reduce(RandomIt first, RandomIt last, T init)
+		{
+			return (ft::par::reduce(first, last, init, std::plus<T>()));
+		}
+
+		/******************/
+		/* INCLUSIVE_SCAN */
+		/******************/
+
+		/*scans chunk i onto the fold of every chunk before it*/
+		template<class It, class OutIt, class T, class BinaryOperation> struct	scan_job
+		{
+			It				first;
+			OutIt			d_first;
+			size_t			n;
+			size_t			chunks;
+			BinaryOperation	op;
+			const T*		carry;
+
+			static void	run(void* p, size_t i)
+			{
+				scan_job&	j = *static_cast<scan_job*>(p);
+				size_t		b = chunk_begin(j.n, j.chunks, i);
+				It			it = j.first + b;
+				It			end = j.first + chunk_begin(j.n, j.chunks, i + 1);
+				OutIt		out = j.d_first + b;
+				T			acc = i ? j.op(j.carry[i - 1], *it) : T(*it);
+
+				*out = acc;
+				while (++it != end)
+				{
+					acc = j.op(acc, *it);
+					*++out = acc;
+				}
+			}
+		};
+
+		/*
+		** Two passes: each chunk is folded, the folds are scanned serially,
+		** then each chunk is scanned from its carry. d_first may be first.
+		*/
+		template<class RandomIt, class OutIt, class BinaryOperation> OutIt	inclusive_scan(RandomIt first, RandomIt last, OutIt d_first, BinaryOperation op)
+		{
+			typedef typename remove_const<typename iterator_traits<RandomIt>::value_type>::type	value_type;
+			size_t	n = last - first;
+			size_t	chunks = chunk_count(n);
+
+			if (chunks < 2)
+				return (std::partial_sum(first, last, d_first, op));
+			ft::vector<value_type>	totals(chunks, *first);
+			fold_job<RandomIt, value_type, BinaryOperation>	fold = {first, n, chunks, op, &totals[0]};
+			pool().run(&fold.run, &fold, chunks - 1);
+			for (size_t i = 1; i < chunks - 1; i++)
+				totals[i] = op(totals[i - 1], totals[i]);
+			scan_job<RandomIt, OutIt, value_type, BinaryOperation>	scan = {first, d_first, n, chunks, op, &totals[0]};
+			pool().run(&scan.run, &scan, chunks);
+			return (d_first + n);
+		}
+
+		template<class RandomIt, class OutIt> OutIt				inclusive_scan(RandomIt first, RandomIt last, OutIt d_first)
+		{
+			typedef typename remove_const<typename iterator_traits<RandomIt>::value_type>::type	value_type;
+			return (ft::par::inclusive_scan(first, last, d_first, std::plus<value_type>()));
+		}
+
+		/********/
+		/* SORT */
+		/********/
+
+		template<class It, class Compare> struct				sort_runs_job
+		{
+			It		first;
+			size_t	n;
+			size_t	runs;
+			Compare	comp;
+			bool	stable;
+
+			static void	run(void* p, size_t i)
+			{
+				sort_runs_job&	j = *static_cast<sort_runs_job*>(p);
+				It				b = j.first + chunk_begin(j.n, j.runs, i);
+				It				e = j.first + chunk_begin(j.n, j.runs, i + 1);
+
+				if (j.stable)
+					std::stable_sort(b, e, j.comp);
+				else
+					std::sort(b, e, j.comp);
+			}
+		};
+
+		/*
+		** Elements of a taken among the first d outputs of the stable merge
+		** of a[0, m) and b[0, k), which takes from a on ties.
+		*/
+		template<class It, class Compare> size_t				merge_split(It a, size_t m, It b, size_t k, size_t d, Compare comp)
+		{
+			size_t	lo = d > k ? d - k : 0;
+			size_t	hi = d < m ? d : m;
+
+			while (lo < hi)
+			{
+				size_t	mid = lo + (hi - lo) / 2;
+				if (comp(b[d - mid - 1], a[mid]))
+					hi = mid;
+				else
+					lo = mid + 1;
+			}
+			return (lo);
+		}
+
+		/*
+		** One merge round: runs of `width` sorted runs are merged pairwise
+		** from src to dst. Each pair's output is cut in 2 * width pieces,
+		** found with merge_split, so a round has as many independent pieces
+		** as the first one had runs.
+		*/
+		template<class SrcIt, class DstIt, class Compare> struct	merge_job
+		{
+			SrcIt	src;
+			DstIt	dst;
+			size_t	n;
+			size_t	runs;
+			size_t	width;
+			Compare	comp;
+
+			static void	run(void* p, size_t i)
+			{
+				merge_job&	j = *static_cast<merge_job*>(p);
+				size_t		pieces = 2 * j.width;
+				size_t		pair = i / pieces;
+				size_t		lo = chunk_begin(j.n, j.runs, pair * pieces);
+				size_t		mid = chunk_begin(j.n, j.runs, pair * pieces + j.width);
+				size_t		hi = chunk_begin(j.n, j.runs, pair * pieces + pieces);
+				size_t		d0 = chunk_begin(hi - lo, pieces, i % pieces);
+				size_t		d1 = chunk_begin(hi - lo, pieces, i % pieces + 1);
+				SrcIt		a = j.src + lo;
+				SrcIt		b = j.src + mid;
+				size_t		a0 = merge_split(a, mid - lo, b, hi - mid, d0, j.comp);
+				size_t		a1 = merge_split(a, mid - lo, b, hi - mid, d1, j.comp);
+
+				std::merge(a + a0, a + a1, b + (d0 - a0), b + (d1 - a1), j.dst + (lo + d0), j.comp);
+			}
+		};
+
+		template<class SrcIt, class DstIt> struct				copy_job
+		{
+			SrcIt	src;
+			DstIt	dst;
+			size_t	n;
+			size_t	chunks;
+
+			static void	run(void* p, size_t i)
+			{
+				copy_job&	j = *static_cast<copy_job*>(p);
+				size_t		b = chunk_begin(j.n, j.chunks, i);
+				std::copy(j.src + b, j.src + chunk_begin(j.n, j.chunks, i + 1), j.dst + b);
+			}
+		};
+
+		/*
+		** Sorts a power of two runs, one or more per thread, then merges them
+		** pairwise back and forth between the range and a buffer, every
+		** round split evenly across the threads.
+		*/
+		template<class RandomIt, class Compare> void			sort_merge(RandomIt first, RandomIt last, Compare comp, bool stable)
+		{
+			typedef typename iterator_traits<RandomIt>::value_type	value_type;
+			typedef typename ft::vector<value_type>::pointer		pointer;
+			size_t	n = last - first;
+			size_t	runs = 1;
+
+			while (runs < threads())
+				runs *= 2;
+			ft::vector<value_type>	buf;
+			buf.resize_default_init(n);
+			pointer	tmp = &buf[0];
+			sort_runs_job<RandomIt, Compare>	sorts = {first, n, runs, comp, stable};
+			pool().run(&sorts.run, &sorts, runs);
+			bool	in_buf = false;
+			for (size_t width = 1; width < runs; width *= 2)
+			{
+				if (in_buf)
+				{
+					merge_job<pointer, RandomIt, Compare>	merge = {tmp, first, n, runs, width, comp};
+					pool().run(&merge.run, &merge, runs);
+				}
+				else
+				{
+					merge_job<RandomIt, pointer, Compare>	merge = {first, tmp, n, runs, width, comp};
+					pool().run(&merge.run, &merge, runs);
+				}
+				in_buf = !in_buf;
+			}
+			if (in_buf)
+			{
+				copy_job<pointer, RandomIt>	copy = {tmp, first, n, runs};
+				pool().run(&copy.run, &copy, runs);
+			}
+		}
+
+		/*value_type must be default constructible for the merge buffer*/
+		template<class RandomIt, class Compare> void			sort(RandomIt first, RandomIt last, Compare comp)
+		{
+			if (chunk_count(last - first) < 2)
+				std::sort(first, last, comp);
+			else
+				sort_merge(first, last, comp, false);
+		}
+
+		template<class RandomIt> void							sort(RandomIt first, RandomIt last)
+		{
+			ft::par::sort(first, last, std::less<typename iterator_traits<RandomIt>::value_type>());
+		}
+
+		template<class RandomIt, class Compare> void			stable_sort(RandomIt first, RandomIt last, Compare comp)
+		{
+			if (chunk_count(last - first) < 2)
+				std::stable_sort(first, last, comp);
+			else
+				sort_merge(first, last, comp, true);
+		}
+
+		template<class RandomIt> void							stable_sort(RandomIt first, RandomIt last)
+		{
+			ft::par::stable_sort(first, last, std::less<typename iterator_traits<RandomIt>::value_type>());
+		}
+	}
+}
+
+#endif
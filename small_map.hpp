@@ -0,0 +1,591 @@
+#ifndef SMALL_MAP_HPP
+# define SMALL_MAP_HPP
+
+# include <memory>
+# include <iterator>
+# include <stdexcept>
+# include "utils.hpp"
+# include "map.hpp"
+
+namespace ft
+{
+	/**************************/
+	/* SMALL MAP ITERATOR     */
+	/**************************/
+
+	/*
+	** Points either into the inline array (_ptr set) or into the promoted
+	** tree (_ptr NULL), so the same iterator type serves both storage modes.
+	*/
+	template<typename T, typename BST> class			small_map_iterator : public std::iterator<std::bidirectional_iterator_tag, T>
+	{
+		public:
+			/*MEMBER TYPES*/
+			typedef typename std::iterator<std::bidirectional_iterator_tag, T>::iterator_category	iterator_category;
+			typedef typename std::iterator<std::bidirectional_iterator_tag, T>::value_type			value_type;
+			typedef typename std::iterator<std::bidirectional_iterator_tag, T>::difference_type		difference_type;
+			typedef T*																				pointer;
+			typedef T&																				reference;
+			typedef ft::map_iterator<T, BST>														tree_iterator;
+
+		private:
+			/*variables*/
+			pointer			_ptr;
+			tree_iterator	_it;
+
+		public:
+			/*MEMBER FUNCTIONS*/
+			small_map_iterator() :
+				_ptr(NULL),
+				_it()
+			{}
+
+			small_map_iterator(pointer p) :
+				_ptr(p),
+				_it()
+			{}
+
+			small_map_iterator(tree_iterator it) :
+				_ptr(NULL),
+				_it(it)
+			{}
+
+			pointer							ptr() const
+			{
+				return (_ptr);
+			}
+
+			tree_iterator					tree() const
+			{
+				return (_it);
+			}
+
+			reference						operator*() const
+			{
+				if (_ptr)
+					return (*_ptr);
+				return (*_it);
+			}
+
+			pointer							operator->() const
+			{
+				return &(operator*());
+			}
+
+			small_map_iterator&				operator++()
+			{
+				if (_ptr)
+					++_ptr;
+				else
+					++_it;
+				return (*this);
+			}
+
+			small_map_iterator				operator++(int)
+			{
+				small_map_iterator	t(*this);
+				++(*this);
+				return (t);
+			}
+
+			small_map_iterator&				operator--()
+			{
+				if (_ptr)
+					--_ptr;
+				else
+					--_it;
+				return (*this);
+			}
+
+			small_map_iterator 				operator--(int)
+			{
+				small_map_iterator	t(*this);
+				--(*this);
+				return (t);
+			}
+
+			operator small_map_iterator<const T, BST>() const
+			{
+				if (_ptr)
+					return (small_map_iterator<const T, BST>(_ptr));
+				return (small_map_iterator<const T, BST>(typename small_map_iterator<const T, BST>::tree_iterator(_it)));
+			}
+
+			template<typename X> bool		operator==(const ft::small_map_iterator<X, BST>& x) const
+			{
+				return (_ptr == x.ptr() && _it == x.tree());
+			}
+
+			template<typename X> bool		operator!=(const ft::small_map_iterator<X, BST>& x) const
+			{
+				return (!(*this == x));
+			}
+	};
+
+	/*************/
+	/* SMALL MAP */
+	/*************/
+
+	/*
+	** Ordered map keeping up to N entries sorted in an inline array, searched
+	** linearly. Inserting an (N + 1)th key moves everything into an ft::map,
+	** which is kept until clear() even if the map shrinks again.
+	*/
+	template < class Key, class T, size_t N = 8, class Compare = std::less<Key>, class Alloc = std::allocator<ft::pair<const Key,T> > > class small_map
+	{
+		public:
+			/*MEMBER TYPES*/
+			typedef Key												key_type;
+			typedef T												mapped_type;
+			typedef ft::pair<const key_type, mapped_type>			value_type;
+			typedef Compare											key_compare;
+			typedef ft::map<Key, T, Compare, Alloc>					tree_type;
+			class													value_compare
+			{
+				friend class small_map<key_type, mapped_type, N, key_compare, Alloc>;
+				protected:
+					Compare			comp;
+					value_compare(Compare c) : comp(c) {}
+				public:
+					bool	operator()(const value_type& x, const value_type& y) const
+					{
+						return (comp(x.first, y.first));
+					}
+			};
+			typedef Alloc											allocator_type;
+			typedef typename allocator_type::reference				reference;
+			typedef typename allocator_type::const_reference		const_reference;
+			typedef typename allocator_type::pointer				pointer;
+			typedef typename allocator_type::const_pointer			const_pointer;
+			typedef ft::small_map_iterator<value_type, typename tree_type::bst_type>		iterator;
+			typedef ft::small_map_iterator<const value_type, typename tree_type::bst_type>	const_iterator;
+			typedef ft::reverse_iterator<iterator>					reverse_iterator;
+			typedef ft::reverse_iterator<const_iterator>			const_reverse_iterator;
+			typedef typename allocator_type::difference_type		difference_type;
+			typedef size_t											size_type;
+
+		private:
+			typedef typename allocator_type::template rebind<tree_type>::other	tree_allocator;
+
+			/*variables*/
+			allocator_type						_allocator;
+			key_compare							_comp;
+			size_type							_size;
+			tree_type*							_tree;
+			ft::aligned_buffer<value_type, N>	_buf;
+
+			/*functions*/
+			pointer			_array()
+			{
+				return (_buf.get());
+			}
+
+			const_pointer	_array() const
+			{
+				return (_buf.get());
+			}
+
+			size_type		_lower_index(const key_type& k) const
+			{
+				size_type	i = 0;
+				while (i < _size && _comp(_array()[i].first, k))
+					i++;
+				return (i);
+			}
+
+			size_type		_upper_index(const key_type& k) const
+			{
+				size_type	i = 0;
+				while (i < _size && !_comp(k, _array()[i].first))
+					i++;
+				return (i);
+			}
+
+			size_type		_find_index(const key_type& k) const
+			{
+				size_type	i = _lower_index(k);
+				if (i < _size && !_comp(k, _array()[i].first))
+					return (i);
+				return (_size);
+			}
+
+			void			_erase_index(size_type i, size_type n)
+			{
+				pointer	a = _array();
+				for (size_type j = i; j < i + n; j++)
+					_allocator.destroy(a + j);
+				for (size_type j = i + n; j < _size; j++)
+				{
+					_allocator.construct(a + j - n, a[j]);
+					_allocator.destroy(a + j);
+				}
+				_size -= n;
+			}
+
+			void			_promote()
+			{
+				tree_allocator	ta(_allocator);
+				pointer			a = _array();
+				tree_type*		t = ta.allocate(1);
+				ta.construct(t, tree_type(_comp, _allocator));
+				for (size_type i = 0; i < _size; i++)
+				{
+					t->insert(a[i]);
+					_allocator.destroy(a + i);
+				}
+				_size = 0;
+				_tree = t;
+			}
+
+			/*takes x's tree or moves its inline entries one by one; *this must be empty and inline*/
+			void			_take(small_map& x)
+			{
+				pointer	a = _array();
+				pointer	b = x._array();
+				_tree = x._tree;
+				x._tree = NULL;
+				for (; _size < x._size; _size++)
+				{
+					_allocator.construct(a + _size, b[_size]);
+					_allocator.destroy(b + _size);
+				}
+				x._size = 0;
+			}
+
+		public:
+			/*MEMBER FUNCTIONS*/
+			explicit small_map(const key_compare& comp = key_compare(), const allocator_type& alloc = allocator_type()) :
+				_allocator(alloc),
+				_comp(comp),
+				_size(0),
+				_tree(NULL)
+			{}
+
+			template<class InputIterator> small_map(InputIterator first, InputIterator last, const key_compare& comp = key_compare(), const allocator_type& alloc = allocator_type()) :
+				_allocator(alloc),
+				_comp(comp),
+				_size(0),
+				_tree(NULL)
+			{
+				insert(first, last);
+			}
+
+			small_map(const small_map& x) :
+				_allocator(x._allocator),
+				_comp(x._comp),
+				_size(0),
+				_tree(NULL)
+			{
+				insert(x.begin(), x.end());
+			}
+
+			~small_map()
+			{
+				clear();
+			}
+
+			small_map&							operator=(const small_map& x)
+			{
+				if (this == &x)
+					return (*this);
+				clear();
+				insert(x.begin(), x.end());
+				return (*this);
+			}
+
+			/*iterators*/
+			iterator							begin()
+			{
+				if (_tree)
+					return (iterator(_tree->begin()));
+				return (iterator(_array()));
+			}
+
+			const_iterator						begin() const
+			{
+				if (_tree)
+					return (const_iterator(static_cast<const tree_type*>(_tree)->begin()));
+				return (const_iterator(_array()));
+			}
+
+			iterator							end()
+			{
+				if (_tree)
+					return (iterator(_tree->end()));
+				return (iterator(_array() + _size));
+			}
+
+			const_iterator						end() const
+			{
+				if (_tree)
+					return (const_iterator(static_cast<const tree_type*>(_tree)->end()));
+				return (const_iterator(_array() + _size));
+			}
+
+			reverse_iterator					rbegin()
+			{
+				return (reverse_iterator(end()));
+			}
+
+			const_reverse_iterator				rbegin() const
+			{
+				return (const_reverse_iterator(end()));
+			}
+
+			reverse_iterator					rend()
+			{
+				return (reverse_iterator(begin()));
+			}
+
+			const_reverse_iterator				rend() const
+			{
+				return (const_reverse_iterator(begin()));
+			}
+
+			/*capacity*/
+			bool								empty() const
+			{
+				return (size() == 0);
+			}
+
+			size_type							size() const
+			{
+				if (_tree)
+					return (_tree->size());
+				return (_size);
+			}
+
+			size_type							max_size() const
+			{
+				return (_allocator.max_size());
+			}
+
+			bool								is_small() const
+			{
+				return (_tree == NULL);
+			}
+
+			/*element access*/
+			mapped_type&						operator[](const key_type& k)
+			{
+				return (*((insert(ft::make_pair(k, mapped_type()))).first)).second;
+			}
+
+			/*modifiers*/
+			pair<iterator, bool>				insert(const value_type& val)
+			{
+				if (_tree)
+				{
+					pair<typename tree_type::iterator, bool>	ret = _tree->insert(val);
+					return (pair<iterator, bool>(iterator(ret.first), ret.second));
+				}
+				pointer		a = _array();
+				size_type	i = _lower_index(val.first);
+				if (i < _size && !_comp(val.first, a[i].first))
+					return (pair<iterator, bool>(iterator(a + i), false));
+				if (_size == N)
+				{
+					_promote();
+					return (insert(val));
+				}
+				for (size_type j = _size; j > i; j--)
+				{
+					_allocator.construct(a + j, a[j - 1]);
+					_allocator.destroy(a + j - 1);
+				}
+				_allocator.construct(a + i, val);
+				_size++;
+				return (pair<iterator, bool>(iterator(a + i), true));
+			}
+
+			iterator							insert(iterator position, const value_type& val)
+			{
+				(void)position;
+				return ((insert(val)).first);
+			}
+
+			template<class InputIterator> void	insert(InputIterator first, InputIterator last)
+			{
+				while (first != last)
+					insert(*first++);
+			}
+
+			void								erase(iterator position)
+			{
+				if (_tree)
+					_tree->erase(position.tree());
+				else
+					_erase_index(position.ptr() - _array(), 1);
+			}
+
+			size_type							erase(const key_type& k)
+			{
+				if (_tree)
+					return (_tree->erase(k));
+				size_type	i = _find_index(k);
+				if (i == _size)
+					return (0);
+				_erase_index(i, 1);
+				return (1);
+			}
+
+			void								erase(iterator first, iterator last)
+			{
+				if (_tree)
+					_tree->erase(first.tree(), last.tree());
+				else
+					_erase_index(first.ptr() - _array(), last.ptr() - first.ptr());
+			}
+
+			/*trees trade pointers, inline entries are moved element-wise*/
+			void								swap(small_map& x)
+			{
+				if (_tree && x._tree)
+				{
+					tree_type*	t = x._tree;
+					x._tree = _tree;
+					_tree = t;
+				}
+				else
+				{
+					small_map	t(_comp, _allocator);
+					t._take(*this);
+					_take(x);
+					x._take(t);
+				}
+				key_compare		c = x._comp;
+				allocator_type	a = x._allocator;
+				x._comp = _comp;
+				x._allocator = _allocator;
+				_comp = c;
+				_allocator = a;
+			}
+
+			void								clear()
+			{
+				if (_tree)
+				{
+					tree_allocator	ta(_allocator);
+					ta.destroy(_tree);
+					ta.deallocate(_tree, 1);
+					_tree = NULL;
+				}
+				_erase_index(0, _size);
+			}
+
+			/*observers*/
+			key_compare							key_comp() const
+			{
+				return (_comp);
+			}
+
+			value_compare						value_comp() const
+			{
+				return (value_compare(_comp));
+			}
+
+			/*operations*/
+			iterator							find(const key_type& k)
+			{
+				if (_tree)
+					return (iterator(_tree->find(k)));
+				return (iterator(_array() + _find_index(k)));
+			}
+
+			const_iterator						find(const key_type& k) const
+			{
+				if (_tree)
+					return (const_iterator(static_cast<const tree_type*>(_tree)->find(k)));
+				return (const_iterator(_array() + _find_index(k)));
+			}
+
+			size_type							count(const key_type& k) const
+			{
+				if (_tree)
+					return (_tree->count(k));
+				return (_find_index(k) != _size);
+			}
+
+			iterator							lower_bound(const key_type& k)
+			{
+				if (_tree)
+					return (iterator(_tree->lower_bound(k)));
+				return (iterator(_array() + _lower_index(k)));
+			}
+
+			const_iterator						lower_bound(const key_type& k) const
+			{
+				if (_tree)
+					return (const_iterator(static_cast<const tree_type*>(_tree)->lower_bound(k)));
+				return (const_iterator(_array() + _lower_index(k)));
+			}
+
+			iterator							upper_bound(const key_type& k)
+			{
+				if (_tree)
+					return (iterator(_tree->upper_bound(k)));
+				return (iterator(_array() + _upper_index(k)));
+			}
+
+			const_iterator						upper_bound(const key_type& k) const
+			{
+				if (_tree)
+					return (const_iterator(static_cast<const tree_type*>(_tree)->upper_bound(k)));
+				return (const_iterator(_array() + _upper_index(k)));
+			}
+
+			pair<const_iterator, const_iterator>equal_range(const key_type& k) const
+			{
+				return (pair<const_iterator, const_iterator>(lower_bound(k), upper_bound(k)));
+			}
+
+			pair<iterator,iterator>				equal_range(const key_type& k)
+			{
+				return (pair<iterator, iterator>(lower_bound(k), upper_bound(k)));
+			}
+
+			/*allocator*/
+			allocator_type						get_allocator() const
+			{
+				return _allocator;
+			}
+	};
+	template<class Key, class T, size_t N, class Compare, class Alloc> bool	operator==(const small_map<Key, T, N, Compare, Alloc>& lhs, const small_map<Key, T, N, Compare, Alloc>& rhs)
+	{
+		if (lhs.size() != rhs.size())
+			return (false);
+		return (ft::equal(lhs.begin(), lhs.end(), rhs.begin()));
+	}
+
+	template<class Key, class T, size_t N, class Compare, class Alloc> bool	operator!=(const small_map<Key, T, N, Compare, Alloc>& lhs, const small_map<Key, T, N, Compare, Alloc>& rhs)
+	{
+		return !(lhs == rhs);
+	}
+
+	template<class Key, class T, size_t N, class Compare, class Alloc> bool	operator<(const small_map<Key, T, N, Compare, Alloc>& lhs, const small_map<Key, T, N, Compare, Alloc>& rhs)
+	{
+		return (ft::lexicographical_compare(lhs.begin(), lhs.end(), rhs.begin(), rhs.end()));
+	}
+
+	template<class Key, class T, size_t N, class Compare, class Alloc> bool	operator<=(const small_map<Key, T, N, Compare, Alloc>& lhs, const small_map<Key, T, N, Compare, Alloc>& rhs)
+	{
+		return !(rhs < lhs);
+	}
+
+	template<class Key, class T, size_t N, class Compare, class Alloc> bool	operator>(const small_map<Key, T, N, Compare, Alloc>& lhs, const small_map<Key, T, N, Compare, Alloc>& rhs)
+	{
+		return (rhs < lhs);
+	}
+
+	template<class Key, class T, size_t N, class Compare, class Alloc> bool	operator>=(const small_map<Key, T, N, Compare, Alloc>& lhs, const small_map<Key, T, N, Compare, Alloc>& rhs)
+	{
+		return !(lhs < rhs);
+	}
+
+	template<class Key, class T, size_t N, class Compare, class Alloc> void	swap(small_map<Key, T, N, Compare, Alloc>& lhs, small_map<Key, T, N, Compare, Alloc>& rhs)
+	{
+		lhs.swap(rhs);
+	}
+}
+
+#endif
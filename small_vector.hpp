@@ -0,0 +1,561 @@
+#ifndef SMALL_VECTOR_HPP
+# define SMALL_VECTOR_HPP
+
+# include <memory>
+# include <iterator>
+# include <stdexcept>
+# include "utils.hpp"
+# include "vector.hpp"
+
+namespace ft
+{
+	/*
+	** Vector that keeps its first N elements in an inline buffer and only
+	** allocates once an (N+1)th element arrives. Same interface and iterator
+	** type as ft::vector; _begin points at the inline buffer while small.
+	*/
+	template<class T, size_t N = 8, class Alloc = std::allocator<T> > class	small_vector : private vector_base<T, Alloc>
+	{
+		public:
+			/*MEMBER TYPES*/
+			typedef T											value_type;
+			typedef Alloc										allocator_type;
+			typedef typename allocator_type::reference			reference;
+			typedef typename allocator_type::const_reference	const_reference;
+			typedef typename allocator_type::pointer			pointer;
+			typedef typename allocator_type::const_pointer		const_pointer;
+			typedef	ft::vector_iterator<value_type>				iterator;
+			typedef ft::vector_iterator<value_type const>		const_iterator;
+			typedef ft::reverse_iterator<iterator>				reverse_iterator;
+			typedef ft::reverse_iterator<const_iterator>		const_reverse_iterator;
+			typedef typename allocator_type::difference_type	difference_type;
+			typedef typename allocator_type::size_type			size_type;
+
+		private:
+			typedef vector_base<T, Alloc>						_base;
+
+			/*variables*/
+			using _base::_allocator;
+			using _base::_begin;
+			using _base::_end;
+			using _base::_capacity;
+			aligned_buffer<value_type, N>			_buf;
+
+			/*functions*/
+			using _base::_move_range;
+			using _base::_destroy_range;
+			using _base::_grow_capacity;
+			using _base::_fill_gap;
+			using _base::_copy_gap;
+
+			pointer									_inline()
+			{
+				return (_buf.get());
+			}
+
+			/*points at the empty inline buffer*/
+			void									_reset_inline()
+			{
+				_begin = _inline();
+				_end = _begin;
+				_capacity = N;
+			}
+
+			/*frees the heap block, if any, and falls back to the inline buffer*/
+			void									_release()
+			{
+				if (_begin != _inline())
+					_allocator.deallocate(_begin, _capacity);
+				_reset_inline();
+			}
+
+			/*opens n uninitialized slots at index p, spilling to the heap at most once*/
+			pointer									_make_gap(size_type p, size_type n)
+			{
+				return (_base::_make_gap(p, n, _begin != _inline()));
+			}
+
+			template <class InputIterator> void		_range_insert(iterator position, InputIterator first, InputIterator last, std::input_iterator_tag)
+			{
+				size_type		p = position.base() - _begin;
+				small_vector	t(_allocator);
+				for (; first != last; ++first)
+					t.push_back(*first);
+				_range_insert(iterator(_begin + p), t.begin(), t.end(), std::random_access_iterator_tag());
+			}
+
+			template <class ForwardIterator> void	_range_insert(iterator position, ForwardIterator first, ForwardIterator last, std::forward_iterator_tag)
+			{
+				size_type	n = ft::distance(first, last);
+				if (!n)
+					return ;
+				_copy_gap(_make_gap(position.base() - _begin, n), n, first);
+			}
+
+			/*empties x into *this, which must be empty; steals x's heap block if it has one*/
+			void									_take(small_vector& x)
+			{
+				_release();
+				if (x._begin != x._inline())
+				{
+					_begin = x._begin;
+					_end = x._end;
+					_capacity = x._capacity;
+				}
+				else
+				{
+					_move_range(_begin, x._begin, x._end);
+					_end = _begin + x.size();
+				}
+				x._reset_inline();
+			}
+
+			FT_COLD void							_grow_push_back(const value_type& val)
+			{
+				value_type	t(val);
+				_fill_gap(_make_gap(size(), 1), 1, t);
+			}
+
+		public:
+			/*MEMBER FUNCTIONS*/
+			explicit								small_vector(const allocator_type& alloc = allocator_type()) :
+				_base(alloc)
+			{
+				_reset_inline();
+			}
+
+			explicit								small_vector(size_type n, const value_type& val = value_type(), const allocator_type& alloc = allocator_type()) :
+				_base(alloc)
+			{
+				_reset_inline();
+				try
+				{
+					insert(end(), n, val);
+				}
+				catch (...)
+				{
+					_release();
+					throw;
+				}
+			}
+
+			template <class InputIterator>			small_vector(InputIterator first, InputIterator last, const allocator_type& alloc = allocator_type(), typename ft::enable_if<!is_integral<InputIterator>::value, InputIterator>::type* = NULL) :
+				_base(alloc)
+			{
+				_reset_inline();
+				try
+				{
+					insert(end(), first, last);
+				}
+				catch (...)
+				{
+					_release();
+					throw;
+				}
+			}
+
+			small_vector(const small_vector& x) :
+				_base(x.get_allocator())
+			{
+				_reset_inline();
+				try
+				{
+					insert(end(), x.begin(), x.end());
+				}
+				catch (...)
+				{
+					_release();
+					throw;
+				}
+			}
+
+			~small_vector()
+			{
+				_destroy_range(_begin, _end);
+				_release();
+			}
+
+# if __cplusplus >= 201103L
+			small_vector(small_vector&& x) :
+				_base(x._allocator)
+			{
+				_reset_inline();
+				*this = std::move(x);
+			}
+
+			small_vector&							operator=(small_vector&& x)
+			{
+				if (this == &x)
+					return (*this);
+				clear();
+				_take(x);
+				return (*this);
+			}
+
+# endif
+			small_vector&							operator=(const small_vector& x)
+			{
+				if (this == &x)
+					return (*this);
+				clear();
+				insert(end(), x.begin(), x.end());
+				return (*this);
+			}
+
+			/*iterators*/
+			iterator								begin()
+			{
+				return (_begin);
+			}
+
+			const_iterator							begin() const
+			{
+				return (_begin);
+			}
+
+			iterator								end()
+			{
+				return (_end);
+			}
+
+			const_iterator							end() const
+			{
+				return (_end);
+			}
+
+			reverse_iterator						rbegin()
+			{
+				return (reverse_iterator(end()));
+			}
+
+			const_reverse_iterator					rbegin() const
+			{
+				return (const_reverse_iterator(end()));
+			}
+
+			reverse_iterator						rend()
+			{
+				return (reverse_iterator(begin()));
+			}
+
+			const_reverse_iterator					rend() const
+			{
+				return (const_reverse_iterator(begin()));
+			}
+
+			/*capacity*/
+			size_type								size() const
+			{
+				return (_end - _begin);
+			}
+
+			size_type								max_size() const
+			{
+				return _allocator.max_size();
+			}
+
+			void									resize(size_type n, value_type val = value_type())
+			{
+				if (n <= size())
+				{
+					_destroy_range(_begin + n, _end);
+					_end = _begin + n;
+				}
+				else
+					insert(end(), n - size(), val);
+			}
+
+			/*
+			** resize() without value-initializing the new elements: trivially
+			** constructible ones are left unwritten, so freshly mapped pages
+			** are not touched until the caller fills them.
+			*/
+			void									resize_default_init(size_type n)
+			{
+				if (n <= size())
+				{
+					_destroy_range(_begin + n, _end);
+					_end = _begin + n;
+					return ;
+				}
+				reserve(n);
+				if (is_trivially_default_constructible<value_type>::value && has_plain_construct<allocator_type>::value)
+					_end = _begin + n;
+				while (size() < n)
+					_allocator.construct(_end++, value_type());
+			}
+
+			size_type								capacity() const
+			{
+				return _capacity;
+			}
+
+			bool									empty() const
+			{
+				return (_begin == _end);
+			}
+
+			/*true while the elements live in the inline buffer*/
+			bool									is_small() const
+			{
+				return (_begin == _buf.get());
+			}
+
+			void									reserve(size_type n)
+			{
+				if (n > max_size())
+					throw std::length_error("L");
+				if (n <= _capacity)
+					return ;
+				pointer		b = _allocator.allocate(n);
+				size_type	s = size();
+				_move_range(b, _begin, _end);
+				if (_begin != _inline())
+					_allocator.deallocate(_begin, _capacity);
+				_begin = b;
+				_end = b + s;
+				_capacity = n;
+			}
+
+			/*moves the elements back inline when they fit, else to an exact-size block*/
+			void									shrink_to_fit()
+			{
+				if (_begin == _inline() || _capacity == size())
+					return ;
+				pointer		b = _begin;
+				size_type	c = _capacity;
+				size_type	n = size();
+				pointer		d = n <= N ? _inline() : _allocator.allocate(n);
+				_move_range(d, b, _end);
+				_allocator.deallocate(b, c);
+				_begin = d;
+				_end = d + n;
+				_capacity = n <= N ? N : n;
+			}
+
+			/*bytes held by the vector itself: the object plus any heap block*/
+			size_type								memory_usage() const
+			{
+				return (sizeof(*this) + (is_small() ? 0 : _capacity * sizeof(value_type)));
+			}
+
+			/*bytes of storage past the last element*/
+			size_type								wasted_bytes() const
+			{
+				return ((_capacity - size()) * sizeof(value_type));
+			}
+
+			/*element access*/
+			reference								operator[](size_type n)
+			{
+				return _begin[n];
+			}
+
+			const_reference							operator[](size_type n) const
+			{
+				return _begin[n];
+			}
+
+			reference								at(size_type n)
+			{
+				if (n >= size())
+					throw std::out_of_range("OOB");
+				return _begin[n];
+			}
+
+			const_reference							at(size_type n) const
+			{
+				if (n >= size())
+					throw std::out_of_range("OOB");
+				return _begin[n];
+			}
+
+			reference								front()
+			{
+				return (*_begin);
+			}
+
+			const_reference							front() const
+			{
+				return (*_begin);
+			}
+
+			reference								back()
+			{
+				return (*(_end - 1));
+			}
+
+			const_reference							back() const
+			{
+				return (*(_end - 1));
+			}
+
+			/*modifiers*/
+			template <class InputIterator> void		assign(InputIterator first, InputIterator last, typename ft::enable_if<!is_integral<InputIterator>::value, InputIterator>::type* = NULL)
+			{
+				clear();
+				insert(end(), first, last);
+			}
+
+			void									assign(size_type n, const value_type& val)
+			{
+				value_type	t(val);
+				clear();
+				insert(end(), n, t);
+			}
+
+			void									push_back(const value_type& val)
+			{
+				if (_end != _begin + _capacity)
+				{
+					_allocator.construct(_end, val);
+					_end++;
+				}
+				else
+					_grow_push_back(val);
+			}
+
+# if __cplusplus >= 201103L
+			template <class... Args> void			emplace_back(Args&&... args)
+			{
+				if (_end != _begin + _capacity)
+				{
+					_allocator.construct(_end, std::forward<Args>(args)...);
+					_end++;
+					return ;
+				}
+				value_type	t(std::forward<Args>(args)...);
+				reserve(_grow_capacity(size() + 1));
+				_allocator.construct(_end, std::move(t));
+				_end++;
+			}
+
+			void									push_back(value_type&& val)
+			{
+				emplace_back(std::move(val));
+			}
+
+# endif
+			void									pop_back()
+			{
+				_end--;
+				_allocator.destroy(_end);
+			}
+
+			iterator								insert(iterator position, const value_type& val)
+			{
+				size_type	p = position.base() - _begin;
+				value_type	t(val);
+				_fill_gap(_make_gap(p, 1), 1, t);
+				return (iterator(_begin + p));
+			}
+
+			void									insert(iterator position, size_type n, const value_type& val)
+			{
+				if (!n)
+					return ;
+				value_type	t(val);
+				_fill_gap(_make_gap(position.base() - _begin, n), n, t);
+			}
+
+			template <class InputIterator> void		insert(iterator position, InputIterator first, InputIterator last, typename ft::enable_if<!is_integral<InputIterator>::value, InputIterator>::type* = NULL)
+			{
+				_range_insert(position, first, last, typename ft::iterator_traits<InputIterator>::iterator_category());
+			}
+
+			iterator								erase(iterator position)
+			{
+				return (erase(position, position + 1));
+			}
+
+			iterator								erase(iterator first, iterator last)
+			{
+				pointer	f = first.base();
+				pointer	l = last.base();
+				if (f == l)
+					return (first);
+				_destroy_range(f, l);
+				_move_range(f, l, _end);
+				_end -= l - f;
+				return (first);
+			}
+
+			/*heap blocks trade pointers, inline contents are moved element-wise*/
+			void									swap(small_vector& x)
+			{
+				if (_begin != _inline() && x._begin != x._inline())
+				{
+					pointer			b = x._begin;
+					pointer			e = x._end;
+					size_type		c = x._capacity;
+					x._begin = _begin;
+					x._end = _end;
+					x._capacity = _capacity;
+					_begin = b;
+					_end = e;
+					_capacity = c;
+				}
+				else
+				{
+					small_vector	t(_allocator);
+					t._take(*this);
+					_take(x);
+					x._take(t);
+				}
+				allocator_type	a = x._allocator;
+				x._allocator = _allocator;
+				_allocator = a;
+			}
+
+			void									clear()
+			{
+				_destroy_range(_begin, _end);
+				_end = _begin;
+			}
+
+			/*allocator*/
+			allocator_type							get_allocator() const
+			{
+				return _allocator;
+			}
+	};
+	/*NON-MEMBER FUNCTION OVERLOADS*/
+	template<class T, size_t N, class Alloc> bool	operator==(const small_vector<T, N, Alloc>& lhs, const small_vector<T, N, Alloc>& rhs)
+	{
+		if (lhs.size() != rhs.size())
+			return (false);
+		return (ft::equal(lhs.begin(), lhs.end(), rhs.begin()));
+	}
+
+	template<class T, size_t N, class Alloc> bool	operator!=(const small_vector<T, N, Alloc>& lhs, const small_vector<T, N, Alloc>& rhs)
+	{
+		return (!(lhs == rhs));
+	}
+
+	template<class T, size_t N, class Alloc> bool	operator<(const small_vector<T, N, Alloc>& lhs, const small_vector<T, N, Alloc>& rhs)
+	{
+		return (ft::lexicographical_compare(lhs.begin(), lhs.end(), rhs.begin(), rhs.end()));
+	}
+
+	template<class T, size_t N, class Alloc> bool	operator<=(const small_vector<T, N, Alloc>& lhs, const small_vector<T, N, Alloc>& rhs)
+	{
+		return (!(rhs < lhs));
+	}
+
+	template<class T, size_t N, class Alloc> bool	operator>(const small_vector<T, N, Alloc>& lhs, const small_vector<T, N, Alloc>& rhs)
+	{
+		return (rhs < lhs);
+	}
+
+	template<class T, size_t N, class Alloc> bool	operator>=(const small_vector<T, N, Alloc>& lhs, const small_vector<T, N, Alloc>& rhs)
+	{
+		return (!(lhs < rhs));
+	}
+
+	template<class T, size_t N, class Alloc> void	swap(small_vector<T, N, Alloc>& x, small_vector<T, N, Alloc>& y)
+	{
+		x.swap(y);
+	}
+}
+
+#endif
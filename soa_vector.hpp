@@ -0,0 +1,381 @@
+#ifndef SOA_VECTOR_HPP
+# define SOA_VECTOR_HPP
+
+# include <memory>
+# include <limits>
+# include <stdexcept>
+# include "utils.hpp"
+# include "vector.hpp"
+
+namespace ft
+{
+	/************/
+	/* SOA SPAN */
+	/************/
+
+	/*
+	** View of one column: a pointer and a length, iterated with raw
+	** pointers so scans compile to plain loops over contiguous memory.
+	*/
+	template<class T> class								soa_span
+	{
+		public:
+			/*MEMBER TYPES*/
+			typedef T			value_type;
+			typedef T*			pointer;
+			typedef T&			reference;
+			typedef T*			iterator;
+			typedef size_t		size_type;
+
+		private:
+			/*variables*/
+			pointer		_data;
+			size_type	_size;
+
+		public:
+			/*MEMBER FUNCTIONS*/
+			soa_span() :
+				_data(NULL),
+				_size(0)
+			{}
+
+			soa_span(pointer data, size_type size) :
+				_data(data),
+				_size(size)
+			{}
+
+			operator soa_span<const T>() const
+			{
+				return (soa_span<const T>(_data, _size));
+			}
+
+			pointer		data() const
+			{
+				return (_data);
+			}
+
+			size_type	size() const
+			{
+				return (_size);
+			}
+
+			bool		empty() const
+			{
+				return (!_size);
+			}
+
+			iterator	begin() const
+			{
+				return (_data);
+			}
+
+			iterator	end() const
+			{
+				return (_data + _size);
+			}
+
+			reference	operator[](size_type n) const
+			{
+				return (_data[n]);
+			}
+	};
+
+	/***************/
+	/* SOA COLUMNS */
+	/***************/
+
+	/*
+	** Type of the unused trailing columns of a soa_vector.
+	*/
+	struct												soa_none {};
+
+	/*
+	** Stands in for the column of a soa_none field: same calls as the
+	** ft::vector holding a real column, none of them doing anything.
+	*/
+	class												soa_empty_column
+	{
+		public:
+			size_t	size() const
+			{
+				return (0);
+			}
+
+			size_t	capacity() const
+			{
+				return (std::numeric_limits<size_t>::max());
+			}
+
+			void	reserve(size_t) {}
+
+			void	resize(size_t, soa_none = soa_none()) {}
+
+			void	push_back(const soa_none&) {}
+
+			void	pop_back() {}
+
+			void	clear() {}
+
+			void	shrink_to_fit() {}
+
+			void	swap(soa_empty_column&) {}
+
+			size_t	memory_usage() const
+			{
+				return (sizeof(*this));
+			}
+
+			size_t	wasted_bytes() const
+			{
+				return (0);
+			}
+	};
+
+	template<class T, class Alloc> struct				soa_column
+	{
+		typedef ft::vector<T, typename Alloc::template rebind<T>::other>	type;
+	};
+
+	template<class Alloc> struct						soa_column<soa_none, Alloc>
+	{
+		typedef soa_empty_column	type;
+	};
+
+	template<size_t I, class T0, class T1, class T2, class T3> struct	soa_element;
+	template<class T0, class T1, class T2, class T3> struct	soa_element<0, T0, T1, T2, T3> { typedef T0 type; };
+	template<class T0, class T1, class T2, class T3> struct	soa_element<1, T0, T1, T2, T3> { typedef T1 type; };
+	template<class T0, class T1, class T2, class T3> struct	soa_element<2, T0, T1, T2, T3> { typedef T2 type; };
+	template<class T0, class T1, class T2, class T3> struct	soa_element<3, T0, T1, T2, T3> { typedef T3 type; };
+
+	/**************/
+	/* SOA VECTOR */
+	/**************/
+
+	/*
+	** Sequence of records of up to four fields stored as one ft::vector per
+	** field, so a scan over one field only streams that field's bytes.
+	** Rows are pushed and erased whole; column<I>() hands out a span over
+	** field I. Alloc is rebound for every column, so an aligned_allocator
+	** aligns each of them.
+	*/
+	template<class T0, class T1, class T2 = soa_none, class T3 = soa_none, class Alloc = std::allocator<char> > class	soa_vector
+	{
+		public:
+			/*MEMBER TYPES*/
+			typedef Alloc			allocator_type;
+			typedef size_t			size_type;
+			typedef ptrdiff_t		difference_type;
+
+		private:
+			typedef typename soa_column<T0, Alloc>::type	column0;
+			typedef typename soa_column<T1, Alloc>::type	column1;
+			typedef typename soa_column<T2, Alloc>::type	column2;
+			typedef typename soa_column<T3, Alloc>::type	column3;
+
+			/*variables*/
+			column0			_c0;
+			column1			_c1;
+			column2			_c2;
+			column3			_c3;
+
+			/*functions*/
+			column0&		_col(integral_constant<size_t, 0>) { return (_c0); }
+			column1&		_col(integral_constant<size_t, 1>) { return (_c1); }
+			column2&		_col(integral_constant<size_t, 2>) { return (_c2); }
+			column3&		_col(integral_constant<size_t, 3>) { return (_c3); }
+			const column0&	_col(integral_constant<size_t, 0>) const { return (_c0); }
+			const column1&	_col(integral_constant<size_t, 1>) const { return (_c1); }
+			const column2&	_col(integral_constant<size_t, 2>) const { return (_c2); }
+			const column3&	_col(integral_constant<size_t, 3>) const { return (_c3); }
+
+			template<class C> static void	_truncate(C& c, size_type n)
+			{
+				while (c.size() > n)
+					c.pop_back();
+			}
+
+			/*drops the rows past n, rolling back a partly applied change*/
+			void			_truncate(size_type n)
+			{
+				_truncate(_c0, n);
+				_truncate(_c1, n);
+				_truncate(_c2, n);
+				_truncate(_c3, n);
+			}
+
+			template<class V> static void	_erase(V& v, size_type i)
+			{
+				v.erase(v.begin() + i);
+			}
+
+			static void		_erase(soa_empty_column&, size_type) {}
+
+			template<class V> static soa_span<typename V::value_type>		_span(V& v)
+			{
+				return (soa_span<typename V::value_type>(v.empty() ? NULL : &v[0], v.size()));
+			}
+
+			template<class V> static soa_span<const typename V::value_type>	_span(const V& v)
+			{
+				return (soa_span<const typename V::value_type>(v.empty() ? NULL : &v[0], v.size()));
+			}
+
+		public:
+			/*MEMBER FUNCTIONS*/
+			soa_vector() {}
+
+			explicit soa_vector(size_type n)
+			{
+				resize(n);
+			}
+
+			/*capacity*/
+			size_type		size() const
+			{
+				return (_c0.size());
+			}
+
+			bool			empty() const
+			{
+				return (!size());
+			}
+
+			/*rows every column can hold without reallocating*/
+			size_type		capacity() const
+			{
+				size_type	c = _c0.capacity();
+				c = _c1.capacity() < c ? _c1.capacity() : c;
+				c = _c2.capacity() < c ? _c2.capacity() : c;
+				return (_c3.capacity() < c ? _c3.capacity() : c);
+			}
+
+			void			reserve(size_type n)
+			{
+				_c0.reserve(n);
+				_c1.reserve(n);
+				_c2.reserve(n);
+				_c3.reserve(n);
+			}
+
+			void			resize(size_type n)
+			{
+				size_type	s = size();
+
+				try
+				{
+					_c0.resize(n);
+					_c1.resize(n);
+					_c2.resize(n);
+					_c3.resize(n);
+				}
+				catch (...)
+				{
+					_truncate(s);
+					throw;
+				}
+			}
+
+			void			shrink_to_fit()
+			{
+				_c0.shrink_to_fit();
+				_c1.shrink_to_fit();
+				_c2.shrink_to_fit();
+				_c3.shrink_to_fit();
+			}
+
+			/*bytes held by the container: the object plus every column buffer*/
+			size_type		memory_usage() const
+			{
+				return (sizeof(*this) + _c0.memory_usage() + _c1.memory_usage() + _c2.memory_usage() + _c3.memory_usage()
+					- sizeof(_c0) - sizeof(_c1) - sizeof(_c2) - sizeof(_c3));
+			}
+
+			size_type		wasted_bytes() const
+			{
+				return (_c0.wasted_bytes() + _c1.wasted_bytes() + _c2.wasted_bytes() + _c3.wasted_bytes());
+			}
+
+			/*element access*/
+			template<size_t I> soa_span<typename soa_element<I, T0, T1, T2, T3>::type>			column()
+			{
+				return (_span(_col(integral_constant<size_t, I>())));
+			}
+
+			template<size_t I> soa_span<const typename soa_element<I, T0, T1, T2, T3>::type>	column() const
+			{
+				return (_span(_col(integral_constant<size_t, I>())));
+			}
+
+			template<size_t I> typename soa_element<I, T0, T1, T2, T3>::type&				get(size_type n)
+			{
+				return (_col(integral_constant<size_t, I>())[n]);
+			}
+
+			template<size_t I> const typename soa_element<I, T0, T1, T2, T3>::type&			get(size_type n) const
+			{
+				return (_col(integral_constant<size_t, I>())[n]);
+			}
+
+			/*modifiers*/
+			/*appends one row; if a field's copy throws, the row is not added*/
+			void			push_back(const T0& a, const T1& b, const T2& c = T2(), const T3& d = T3())
+			{
+				size_type	s = size();
+
+				try
+				{
+					_c0.push_back(a);
+					_c1.push_back(b);
+					_c2.push_back(c);
+					_c3.push_back(d);
+				}
+				catch (...)
+				{
+					_truncate(s);
+					throw;
+				}
+			}
+
+			void			pop_back()
+			{
+				_c0.pop_back();
+				_c1.pop_back();
+				_c2.pop_back();
+				_c3.pop_back();
+			}
+
+			/*removes row n, shifting the rows after it*/
+			void			erase(size_type n)
+			{
+				if (n >= size())
+					throw std::out_of_range("OOB");
+				_erase(_c0, n);
+				_erase(_c1, n);
+				_erase(_c2, n);
+				_erase(_c3, n);
+			}
+
+			void			swap(soa_vector& x)
+			{
+				_c0.swap(x._c0);
+				_c1.swap(x._c1);
+				_c2.swap(x._c2);
+				_c3.swap(x._c3);
+			}
+
+			void			clear()
+			{
+				_c0.clear();
+				_c1.clear();
+				_c2.clear();
+				_c3.clear();
+			}
+	};
+
+	template<class T0, class T1, class T2, class T3, class Alloc> void	swap(soa_vector<T0, T1, T2, T3, Alloc>& x, soa_vector<T0, T1, T2, T3, Alloc>& y)
+	{
+		x.swap(y);
+	}
+}
+
+#endif
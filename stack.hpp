@@ -2,12 +2,12 @@
 # define STACK_HPP
 
 # include <stdexcept>
-# include <deque>
 # include "utils.hpp"
+# include "deque.hpp"
 
 namespace ft
 {
-	template <class T, class Container = std::deque<T> > class stack
+	template <class T, class Container = ft::deque<T> > class stack
 	{
 		public:
 			/*MEMBER TYPES*/
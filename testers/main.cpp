@@ -26,8 +26,10 @@ void print_error()
 	std::cout << "Pass the name of the test in argument."  << std::endl;
 	std::cout << "List of valid args : "  << std::endl;
 	std::cout << "- stack"  << std::endl;
+	std::cout << "- deque"  << std::endl;
 	std::cout << "- vector"  << std::endl;
 	std::cout << "- map"  << std::endl;
+	std::cout << "- par"  << std::endl;
 	std::cout << "- all"  << std::endl;
 }
 
@@ -92,15 +94,21 @@ int main(int argc, char **argv)
 	if (test == "all")
 	{
 		test_stack();
+		test_deque();
 		test_vector();
 		test_map();
+		test_par();
 	}
 	else if (test == "stack")
 		test_stack();
+	else if (test == "deque")
+		test_deque();
 	else if (test == "vector")
 		test_vector();
 	else if (test == "map")
 		test_map();
+	else if (test == "par")
+		test_par();
 	else
 	{
 		print_error();
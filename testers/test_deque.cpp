@@ -0,0 +1,177 @@
+#include "tester.hpp"
+
+template <typename T>
+static bool	same_deque(ft::deque<T> &a, std::deque<T> &b)
+{
+	if (a.size() != b.size() || a.empty() != b.empty())
+		return (false);
+	for (size_t i = 0; i < a.size(); i++)
+		if (a[i] != b[i])
+			return (false);
+	return (true);
+}
+
+void	test_deque_ends()
+{
+	print_title("Push / Pop both ends");
+	ft::deque<int>	my1;
+	std::deque<int>	real1;
+
+	check("Empty", same_deque(my1, real1));
+	for (int i = 0; i < 5000; i++)
+	{
+		my1.push_back(i);
+		real1.push_back(i);
+		my1.push_front(-i);
+		real1.push_front(-i);
+	}
+	check("Push back / front", same_deque(my1, real1));
+	check("Front / back", my1.front() == real1.front() && my1.back() == real1.back());
+	for (int i = 0; i < 3000; i++)
+	{
+		my1.pop_front();
+		real1.pop_front();
+	}
+	for (int i = 0; i < 6000; i++)
+	{
+		my1.pop_back();
+		real1.pop_back();
+	}
+	check("Pop back / front", same_deque(my1, real1));
+	while (!my1.empty())
+	{
+		my1.pop_front();
+		real1.pop_front();
+	}
+	check("Pop all", same_deque(my1, real1));
+	for (int i = 0; i < 20000; i++)
+	{
+		my1.push_front(i);
+		real1.push_front(i);
+		if (i % 3 == 0)
+		{
+			my1.pop_back();
+			real1.pop_back();
+		}
+	}
+	check("Queue like", same_deque(my1, real1));
+	my1.push_back(my1.front());
+	real1.push_back(real1.front());
+	check("Push own element", same_deque(my1, real1));
+}
+
+void	test_deque_access()
+{
+	print_title("Access / Iterators");
+	ft::deque<std::string>	my1;
+	std::deque<std::string>	real1;
+
+	for (int i = 0; i < 300; i++)
+	{
+		my1.push_back(std::string(i % 40, 'a' + i % 26));
+		real1.push_back(std::string(i % 40, 'a' + i % 26));
+	}
+	check("At", my1.at(150), real1.at(150));
+	try
+	{
+		my1.at(300);
+		check("At out of range", false);
+	}
+	catch (std::out_of_range &e)
+	{
+		check("At out of range", true);
+	}
+	check("Iterator distance", (long)(my1.end() - my1.begin()), (long)(real1.end() - real1.begin()));
+	check("Iterator +", *(my1.begin() + 123), *(real1.begin() + 123));
+	check("Iterator []", my1.begin()[77], real1.begin()[77]);
+	check("Reverse iterator", *(my1.rbegin() + 5), *(real1.rbegin() + 5));
+	ft::deque<std::string>::const_iterator	cit = my1.begin();
+	std::deque<std::string>::const_iterator	rit = real1.begin();
+	bool									ret = true;
+	for (; cit != my1.end(); ++cit, ++rit)
+		if (*cit != *rit)
+			ret = false;
+	check("Const iterator", ret);
+}
+
+void	test_deque_modifiers()
+{
+	print_title("Insert / Erase / Assign");
+	ft::deque<std::string>	my1;
+	std::deque<std::string>	real1;
+
+	for (int i = 0; i < 100; i++)
+	{
+		my1.push_back(std::string(1, 'a' + i % 26));
+		real1.push_back(std::string(1, 'a' + i % 26));
+	}
+	my1.insert(my1.begin() + 10, "front");
+	real1.insert(real1.begin() + 10, "front");
+	my1.insert(my1.begin() + 80, "back");
+	real1.insert(real1.begin() + 80, "back");
+	check("Insert", same_deque(my1, real1));
+	my1.insert(my1.begin() + 3, 50, my1[7]);
+	real1.insert(real1.begin() + 3, 50, real1[7]);
+	my1.insert(my1.end() - 3, 70, "fill");
+	real1.insert(real1.end() - 3, 70, "fill");
+	check("Insert fill", same_deque(my1, real1));
+	std::list<std::string>	lst(30, "list");
+	lst.push_back("last");
+	my1.insert(my1.begin() + 20, lst.begin(), lst.end());
+	real1.insert(real1.begin() + 20, lst.begin(), lst.end());
+	my1.insert(my1.begin() + 200, lst.begin(), lst.end());
+	real1.insert(real1.begin() + 200, lst.begin(), lst.end());
+	check("Insert range", same_deque(my1, real1));
+	my1.erase(my1.begin() + 5);
+	real1.erase(real1.begin() + 5);
+	my1.erase(my1.begin() + 10, my1.begin() + 40);
+	real1.erase(real1.begin() + 10, real1.begin() + 40);
+	my1.erase(my1.end() - 60, my1.end() - 20);
+	real1.erase(real1.end() - 60, real1.end() - 20);
+	check("Erase", same_deque(my1, real1));
+	check("Erase return", *my1.erase(my1.begin() + 2), *real1.erase(real1.begin() + 2));
+
+	ft::deque<std::string>	my2(my1);
+	check("Copy", (my2 == my1), true);
+	my2.assign(5, "five");
+	real1.assign(5, "five");
+	check("Assign", same_deque(my2, real1));
+	my2 = my1;
+	check("Assignation", (my2 == my1), true);
+	my2.resize(3);
+	my2.resize(10, "r");
+	check("Resize", my2.size() == 10 && my2.back() == "r");
+	my2.swap(my1);
+	check("Swap", my1.size(), (size_t)10);
+	check("Compare", (my1 < my2), (my1[0] < my2[0] || (my1[0] == my2[0] && my1[1] < my2[1])));
+	my2.clear();
+	my2.shrink_to_fit();
+	check("Clear", my2.empty(), true);
+	my2.push_front("again");
+	check("Reuse", my2.front(), std::string("again"));
+
+	typedef ft::deque<int, tagged_allocator<int> >	tagged_deque;
+	tagged_count()[1] = 0;
+	tagged_count()[2] = 0;
+	{
+		tagged_deque	my3((tagged_allocator<int>(1)));
+		tagged_deque	my4((tagged_allocator<int>(2)));
+		for (int i = 0; i < 20000; i++)
+			my3.push_back(i);
+		my4.push_back(0);
+		my3.swap(my4);
+		my3.push_front(1);
+	}
+	check("Swap allocator", tagged_count()[1] == 0 && tagged_count()[2] == 0);
+}
+
+void	test_deque()
+{
+	print_header("DEQUE");
+	test_deque_ends();
+	P("");
+	test_deque_access();
+	P("");
+	test_deque_modifiers();
+	P("");
+}
@@ -1,5 +1,7 @@
 #include "tester.hpp"
 #include <map>
+#include <fstream>
+#include <limits>
 #include <sys/time.h>
 
 template <class Key, class Val>
@@ -199,7 +201,12 @@ void	test_map_iterators()
 		++myItrc;
 		++realItrc;
 	}
+	if (myItrc != myItrce)
+		ret = false;
 	check("Iterator rev const", ret);
+
+	check("Iterator size", sizeof(ft::map<int, std::string>::iterator), sizeof(void*));
+	check("Iterator --end", (--my1.end())->first, (--real1.end())->first);
 }
 
 void	test_map_capacity()
@@ -416,6 +423,291 @@ void	test_map_operations()
 	print_vraie_map_values(real1, "int");
 }
 
+struct	big_record
+{
+	int		id;
+	char	payload[196];
+};
+
+void	test_map_split()
+{
+	print_title("Out-of-line values");
+	ft::map<int, big_record>	my1;
+	std::map<int, int>			real1;
+	big_record					rec;
+
+	for (int i = 0; i < 50; i++)
+	{
+		rec.id = i * 3;
+		my1[(i * 17) % 53] = rec;
+		real1[(i * 17) % 53] = i * 3;
+	}
+	my1.erase(17);
+	real1.erase(17);
+	my1.erase(my1.begin());
+	real1.erase(real1.begin());
+
+	bool ret = (my1.size() == real1.size());
+	ft::map<int, big_record>::iterator myIt = my1.begin();
+	for (std::map<int, int>::iterator realIt = real1.begin(); ret && realIt != real1.end(); ++realIt, ++myIt)
+		if (myIt->first != realIt->first || myIt->second.id != realIt->second)
+			ret = false;
+	check("Split iterator", ret);
+	check("Split find", my1.find(34)->second.id, real1.find(34)->second);
+	check("Split lower bound", my1.lower_bound(17)->first, real1.lower_bound(17)->first);
+
+	ft::map<int, big_record>	my2(my1);
+	my2.swap(my1);
+	check("Split copy", my2.size(), real1.size());
+	my1.clear();
+	check("Split clear", my1.empty(), true);
+
+	typedef tagged_allocator<ft::pair<const int, big_record> >	tagged;
+	tagged_count()[0] = 0;
+	{
+		ft::map<int, big_record, std::less<int>, tagged>	my3(std::less<int>(), tagged(3));
+		ft::map<int, big_record, std::less<int>, tagged>	my4(std::less<int>(), tagged(4));
+		for (int i = 0; i < 100; i++)
+			my3[i] = rec;
+		for (int i = 0; i < 10; i++)
+			my4[i] = rec;
+		check("Split allocator", tagged_count()[3] > 0 && tagged_count()[4] > 0 && tagged_count()[0] == 0);
+		my3.swap(my4);
+		my3.erase(2);
+		my4[20] = rec;
+	}
+	check("Split swap allocator", tagged_count()[3] == 0 && tagged_count()[4] == 0);
+}
+
+/*comparator whose order is part of its state*/
+struct	directed_less
+{
+	bool	descending;
+
+	directed_less(bool d = false) : descending(d) {}
+
+	bool	operator()(int a, int b) const
+	{
+		return (descending ? b < a : a < b);
+	}
+};
+
+/*keys of a small_map in iteration order*/
+template <class M>
+std::string	small_keys(const M& m)
+{
+	std::string	s;
+	for (typename M::const_iterator it = m.begin(); it != m.end(); ++it)
+		s += static_cast<char>('0' + it->first);
+	return (s);
+}
+
+void	test_small_map_swap()
+{
+	typedef ft::small_map<int, int, 4, directed_less>	small_type;
+	small_type	up;
+	small_type	down((directed_less(true)));
+
+	for (int i = 1; i <= 3; i++)
+		up[i] = i;
+	for (int i = 1; i <= 6; i++)
+		down[i] = i;
+	up.swap(down);
+	check("Small swap mixed", small_keys(up) == "654321" && small_keys(down) == "123" && !up.is_small() && down.is_small());
+	up[7] = 7;
+	down[0] = 0;
+	check("Small swap comp", small_keys(up) == "7654321" && small_keys(down) == "0123");
+	check("Small value comp", up.value_comp()(*up.begin(), *down.begin()) && !down.value_comp()(*up.begin(), *down.begin()));
+	small_type	wide;
+	for (int i = 1; i <= 5; i++)
+		wide[i] = i;
+	wide.swap(up);
+	check("Small swap trees", small_keys(wide) == "7654321" && small_keys(up) == "12345");
+	up.swap(down);
+	check("Small swap inline", small_keys(up) == "0123" && small_keys(down) == "12345");
+
+	tagged_count()[0] = 0;
+	{
+		ft::small_map<int, int, 2, std::less<int>, tagged_allocator<ft::pair<const int, int> > >	tagged(std::less<int>(), tagged_allocator<ft::pair<const int, int> >(5));
+		for (int i = 0; i < 4; i++)
+			tagged[i] = i;
+		check("Small allocator", tagged_count()[5] > 0 && tagged_count()[0] == 0);
+	}
+}
+
+void	test_small_map()
+{
+	print_title("Small map");
+	ft::small_map<int, std::string, 4>	my1;
+	std::map<int, std::string>			real1;
+
+	my1[3] = "trois";
+	my1[1] = "un";
+	my1[2] = "deux";
+	real1[3] = "trois";
+	real1[1] = "un";
+	real1[2] = "deux";
+	check("Small insert", my1.size(), real1.size());
+	check("Small inline", my1.is_small(), true);
+	check("Small find", my1.find(2)->second, real1.find(2)->second);
+	check("Small lower bound", my1.lower_bound(2)->first, real1.lower_bound(2)->first);
+	check("Small upper bound", my1.upper_bound(2)->first, real1.upper_bound(2)->first);
+	check("Small begin", my1.begin()->second, real1.begin()->second);
+	check("Small rbegin", my1.rbegin()->second, real1.rbegin()->second);
+
+	my1.erase(2);
+	real1.erase(2);
+	check("Small erase", my1.count(2), real1.count(2));
+
+	for (int i = 10; i < 20; i++)
+	{
+		my1.insert(ft::make_pair(i, std::string("x")));
+		real1.insert(std::make_pair(i, std::string("x")));
+	}
+	check("Small promoted", my1.is_small(), false);
+	bool ret = (my1.size() == real1.size());
+	ft::small_map<int, std::string, 4>::const_iterator myIt = my1.begin();
+	for (std::map<int, std::string>::iterator realIt = real1.begin(); ret && realIt != real1.end(); ++realIt, ++myIt)
+		if (myIt->first != realIt->first || myIt->second != realIt->second)
+			ret = false;
+	check("Small iterator promoted", ret);
+	check("Small find promoted", my1.find(15)->first, real1.find(15)->first);
+
+	ft::small_map<int, std::string, 4>	my2(my1);
+	check("Small copy", (my2 == my1), true);
+	my2.clear();
+	check("Small clear", my2.is_small(), true);
+	my2[7] = "sept";
+	my2.swap(my1);
+	check("Small swap", my2.size(), real1.size());
+	check("Small swap", my1.begin()->second, std::string("sept"));
+	test_small_map_swap();
+}
+
+void	test_interval_map()
+{
+	print_title("Interval map");
+	ft::interval_map<int, int>	my1;
+	std::map<std::pair<int, int>, int>	real1;
+
+	for (int i = 0; i < 200; i++)
+	{
+		int	lo = (i * 7919) % 1000;
+		int	hi = lo + (i * 31) % 50;
+		my1[ft::make_pair(lo, hi)] = i;
+		real1[std::make_pair(lo, hi)] = i;
+	}
+	for (int i = 0; i < 200; i += 3)
+	{
+		int	lo = (i * 7919) % 1000;
+		int	hi = lo + (i * 31) % 50;
+		my1.erase(ft::make_pair(lo, hi));
+		real1.erase(std::make_pair(lo, hi));
+	}
+	check("Interval size", my1.size(), real1.size());
+
+	bool ret = true;
+	ft::interval_map<int, int>::iterator myIt = my1.begin();
+	for (std::map<std::pair<int, int>, int>::iterator realIt = real1.begin(); ret && realIt != real1.end(); ++realIt, ++myIt)
+		if (myIt->first.first != realIt->first.first || myIt->first.second != realIt->first.second || myIt->second != realIt->second)
+			ret = false;
+	check("Interval iterator", ret);
+
+	ret = true;
+	for (int q = 0; q < 1100 && ret; q += 13)
+	{
+		ft::vector<ft::interval_map<int, int>::iterator>	found;
+		size_t												expected = 0;
+		my1.overlaps(q, q + 20, found);
+		for (std::map<std::pair<int, int>, int>::iterator realIt = real1.begin(); realIt != real1.end(); ++realIt)
+			if (realIt->first.first <= q + 20 && realIt->first.second >= q)
+				expected++;
+		if (found.size() != expected || my1.overlaps(q, q + 20) != (expected != 0))
+			ret = false;
+		for (size_t i = 0; i < found.size(); i++)
+			if (found[i]->first.first > q + 20 || found[i]->first.second < q)
+				ret = false;
+	}
+	check("Interval overlaps", ret);
+	check("Interval find", my1.find(ft::make_pair(7919 % 1000, 7919 % 1000 + 31))->second, 1);
+	my1.clear();
+	check("Interval clear", my1.overlaps(0, 2000), false);
+}
+
+void	test_map_mmap()
+{
+	print_title("Memory-mapped image");
+	ft::map<int, double>	my1;
+	std::map<int, double>	real1;
+	const char*				path = "/tmp/ft_containers_test.map";
+
+	for (int i = 0; i < 100; i++)
+	{
+		my1[(i * 37) % 101] = i / 2.0;
+		real1[(i * 37) % 101] = i / 2.0;
+	}
+	ft::mmap_map<int, double>::write(my1, path);
+	ft::mmap_map<int, double>	img(path);
+
+	check("Image size", img.size(), real1.size());
+	bool ret = true;
+	ft::mmap_map<int, double>::const_iterator myIt = img.begin();
+	for (std::map<int, double>::iterator realIt = real1.begin(); realIt != real1.end(); ++realIt, ++myIt)
+		if (myIt->first != realIt->first || myIt->second != realIt->second)
+			ret = false;
+	check("Image iterator", ret);
+	check("Image find", img.find(37)->second, real1.find(37)->second);
+	check("Image find not found", (img.find(500) == img.end()), (real1.find(500) == real1.end()));
+	check("Image count", img.count(0), real1.count(0));
+	check("Image lower bound", img.lower_bound(50)->first, real1.lower_bound(50)->first);
+	check("Image upper bound", img.upper_bound(50)->first, real1.upper_bound(50)->first);
+	check("Image rbegin", img.rbegin()->first, real1.rbegin()->first);
+
+	typedef ft::mmap_map<int, double>::size_type	size_type;
+	size_type	count = std::numeric_limits<size_type>::max() / sizeof(ft::pair<const int, double>) + 2;
+	std::fstream	file(path, std::ios::in | std::ios::out | std::ios::binary);
+	file.seekp(8 + 3 * sizeof(size_type));
+	file.write(reinterpret_cast<const char*>(&count), sizeof(count));
+	file.close();
+	try
+	{
+		ft::mmap_map<int, double>	bad(path);
+		check("Image count overflow", false);
+	}
+	catch (std::runtime_error&)
+	{
+		check("Image count overflow", true);
+	}
+	std::remove(path);
+}
+
+#if __cplusplus >= 201103L
+void	test_map_move()
+{
+	print_title("Move / Emplace");
+	ft::map<int, std::string>	my1;
+	std::map<int, std::string>	real1;
+
+	insert_map_values(my1, real1);
+	check("Emplace", my1.emplace(4, "quatre").second, real1.emplace(4, "quatre").second);
+	check("Emplace existing", my1.emplace(4, "four").second, real1.emplace(4, "four").second);
+	check("Insert rvalue", my1.insert(ft::pair<const int, std::string>(5, std::string(30, 'c'))).second,
+		real1.insert(std::pair<const int, std::string>(5, std::string(30, 'c'))).second);
+	check("Emplace", (my1 == real1));
+
+	ft::map<int, std::string>	my2(std::move(my1));
+	std::map<int, std::string>	real2(std::move(real1));
+	check("Move constructor", (my2 == real2));
+	check("Move constructor source", my1.empty(), true);
+	my1 = std::move(my2);
+	real1 = std::move(real2);
+	check("Move assignation", (my1 == real1));
+	check("Pair convertible", std::is_constructible<ft::pair<int, std::string>, int, const char*>::value);
+	check("Pair unconvertible", !std::is_constructible<ft::pair<int, std::string>, int, int>::value
+		&& !std::is_constructible<ft::pair<int, int>, std::string, int>::value);
+}
+
+#endif
 void	test_map()
 {
 	print_header("MAP");
@@ -445,7 +737,19 @@ void	test_map()
 	P("");
 	test_map_operations();
 	P("");
+	test_map_split();
+	P("");
+	test_map_mmap();
+	P("");
+	test_small_map();
+	P("");
+	test_interval_map();
+	P("");
+#if __cplusplus >= 201103L
+	test_map_move();
+	P("");
+#endif
 
     gettimeofday(&todms, NULL);
     std::cout << "Global start end : " << todms.tv_usec << std::endl;
-}
\ No newline at end of file
+}
\ No newline at end of file
@@ -0,0 +1,175 @@
+#include "tester.hpp"
+#include <algorithm>
+#include <numeric>
+
+struct	triple
+{
+	void	operator()(long& x) const
+	{
+		x *= 3;
+	}
+};
+
+struct	halve
+{
+	long	operator()(long x) const
+	{
+		return (x / 2);
+	}
+};
+
+struct	add_mod
+{
+	long	operator()(long a, long b) const
+	{
+		return ((a + b) % 1000003);
+	}
+};
+
+struct	by_key
+{
+	bool	operator()(const std::pair<int, int>& a, const std::pair<int, int>& b) const
+	{
+		return (a.first < b.first);
+	}
+};
+
+struct	thrower
+{
+	void	operator()(long& x) const
+	{
+		if (x == 77777)
+			throw std::logic_error("x");
+	}
+};
+
+static void	fill(ft::vector<long>& my, std::vector<long>& real, size_t n)
+{
+	unsigned long	state = 88172645463325252UL;
+
+	my.clear();
+	real.clear();
+	for (size_t i = 0; i < n; i++)
+	{
+		state ^= state << 13;
+		state ^= state >> 7;
+		state ^= state << 17;
+		my.push_back(static_cast<long>(state % 100000));
+		real.push_back(my.back());
+	}
+}
+
+void	test_par_elementwise()
+{
+	print_title("For_each / Transform");
+	ft::vector<long>	my1;
+	std::vector<long>	real1;
+
+	fill(my1, real1, 300000);
+	ft::par::for_each(my1.begin(), my1.end(), triple());
+	std::for_each(real1.begin(), real1.end(), triple());
+	check("For_each", my1 == real1);
+	ft::vector<long>	my2(my1.size());
+	std::vector<long>	real2(real1.size());
+	check("Transform end", ft::par::transform(my1.begin(), my1.end(), my2.begin(), halve()) == my2.end());
+	std::transform(real1.begin(), real1.end(), real2.begin(), halve());
+	check("Transform", my2 == real2);
+	ft::par::transform(my1.begin(), my1.end(), my1.begin(), halve());
+	check("Transform in place", my1 == real2);
+	fill(my1, real1, 1000);
+	ft::par::for_each(my1.begin(), my1.end(), triple());
+	std::for_each(real1.begin(), real1.end(), triple());
+	check("Below cutoff", my1 == real1);
+	fill(my1, real1, 300000);
+	bool	thrown = false;
+	try
+	{
+		ft::par::for_each(my1.begin(), my1.end(), thrower());
+	}
+	catch (std::exception&)
+	{
+		thrown = true;
+	}
+	check("Throwing function", thrown == (std::find(real1.begin(), real1.end(), 77777) != real1.end()));
+	ft::par::for_each(my1.begin(), my1.end(), triple());
+	std::for_each(real1.begin(), real1.end(), triple());
+	check("Pool after throw", my1 == real1);
+}
+
+void	test_par_reduce()
+{
+	print_title("Reduce / Inclusive_scan");
+	ft::vector<long>	my1;
+	std::vector<long>	real1;
+
+	fill(my1, real1, 300001);
+	check("Reduce", ft::par::reduce(my1.begin(), my1.end(), 5L), std::accumulate(real1.begin(), real1.end(), 5L));
+	check("Reduce op", ft::par::reduce(my1.begin(), my1.end(), 0L, add_mod()), std::accumulate(real1.begin(), real1.end(), 0L, add_mod()));
+	check("Reduce empty", ft::par::reduce(my1.begin(), my1.begin(), 9L), 9L);
+	ft::vector<long>	my2(my1.size());
+	std::vector<long>	real2(real1.size());
+	ft::par::inclusive_scan(my1.begin(), my1.end(), my2.begin());
+	std::partial_sum(real1.begin(), real1.end(), real2.begin());
+	check("Inclusive_scan", my2 == real2);
+	ft::par::inclusive_scan(my1.begin(), my1.end(), my1.begin(), add_mod());
+	std::partial_sum(real1.begin(), real1.end(), real1.begin(), add_mod());
+	check("Scan in place", my1 == real1);
+	fill(my1, real1, 10);
+	ft::par::inclusive_scan(my1.begin(), my1.end(), my1.begin());
+	std::partial_sum(real1.begin(), real1.end(), real1.begin());
+	check("Scan below cutoff", my1 == real1);
+}
+
+void	test_par_sort()
+{
+	print_title("Sort / Stable_sort");
+	ft::vector<long>	my1;
+	std::vector<long>	real1;
+
+	fill(my1, real1, 300007);
+	ft::par::sort(my1.begin(), my1.end());
+	std::sort(real1.begin(), real1.end());
+	check("Sort", my1 == real1);
+	ft::par::sort(my1.begin(), my1.end(), std::greater<long>());
+	std::sort(real1.begin(), real1.end(), std::greater<long>());
+	check("Sort descending", my1 == real1);
+	ft::par::sort(my1.begin(), my1.end());
+	std::sort(real1.begin(), real1.end());
+	check("Sort sorted input", my1 == real1);
+	fill(my1, real1, 100);
+	ft::par::sort(my1.begin(), my1.end());
+	std::sort(real1.begin(), real1.end());
+	check("Sort below cutoff", my1 == real1);
+
+	ft::vector<std::pair<int, int> >	my2;
+	std::vector<std::pair<int, int> >	real2;
+	fill(my1, real1, 200000);
+	for (size_t i = 0; i < my1.size(); i++)
+	{
+		my2.push_back(std::make_pair(static_cast<int>(my1[i] % 100), static_cast<int>(i)));
+		real2.push_back(my2.back());
+	}
+	ft::par::stable_sort(my2.begin(), my2.end(), by_key());
+	std::stable_sort(real2.begin(), real2.end(), by_key());
+	check("Stable_sort", my2 == real2);
+	ft::par::stable_sort(&my2[0], &my2[0] + my2.size());
+	std::stable_sort(real2.begin(), real2.end());
+	check("Stable_sort pointers", my2 == real2);
+}
+
+void	test_par()
+{
+	print_header("PARALLEL");
+	ft::par::set_threads(4);
+	check("Threads", ft::par::threads(), static_cast<size_t>(4));
+	test_par_elementwise();
+	P("");
+	test_par_reduce();
+	P("");
+	test_par_sort();
+	P("");
+	ft::par::set_threads(1);
+	test_par_sort();
+	P("");
+	ft::par::set_threads(0);
+}
@@ -1,4 +1,9 @@
 #include "tester.hpp"
+#include <algorithm>
+#include <fstream>
+#include <limits>
+#include <sstream>
+#include <iterator>
 
 /*
 ** Printers
@@ -213,6 +218,38 @@ void	test_vct_capacity()
 	real1.reserve((size_t)20);
 	check("Reserve", (my1 == real1));
 	check("Size", my1.size(), real1.size());
+
+	my1.resize_default_init((size_t)50);
+	real1.resize((size_t)50);
+	for (size_t i = 9; i < 50; i++)
+		my1[i] = real1[i] = (int)i;
+	check("Resize default init", (my1 == real1));
+	my1.resize_default_init((size_t)4);
+	real1.resize((size_t)4);
+	check("Resize default shrink", (my1 == real1));
+
+	ft::vector<std::string>		my2(3, "abc");
+	std::vector<std::string>	real2(3, "abc");
+	my2.resize_default_init(6);
+	real2.resize(6);
+	check("Resize default string", (my2 == real2));
+
+	my1.reserve(100);
+	check("Wasted bytes", my1.wasted_bytes(), (100 - my1.size()) * sizeof(int));
+	check("Memory usage", my1.memory_usage(), sizeof(my1) + 100 * sizeof(int));
+	my1.shrink_to_fit();
+	check("Shrink to fit", (my1 == real1) && my1.capacity() == my1.size() && !my1.wasted_bytes());
+	my2.reserve(50);
+	my2.shrink_to_fit();
+	check("Shrink to fit string", (my2 == real2) && my2.capacity() == 6);
+	my2.clear();
+	my2.shrink_to_fit();
+	check("Shrink to fit empty", my2.capacity(), (size_t)0);
+
+	ft::vector<unsigned long, ft::mmap_allocator<unsigned long> >	my3(100000, 3);
+	my3.resize(70000);
+	my3.shrink_to_fit();
+	check("Shrink to fit mmap", my3.capacity() == 70000 && my3[69999] == 3);
 }
 
 /*
@@ -281,6 +318,31 @@ void	test_vct_assign()
 	my2.assign((size_t)5, 19);
 	real2.assign((size_t)5, 19);
 	check("Assign val", (my2 == real2));
+
+	my2.reserve(64);
+	int	*data = &my2[0];
+	my2.assign((size_t)40, 7);
+	real2.assign((size_t)40, 7);
+	my2.assign(my1.begin(), my1.end());
+	real2.assign(real1.begin(), real1.end());
+	my1 = my2;
+	check("Assign reuse", (my2 == real2) && &my2[0] == data && my2.capacity() == 64);
+
+	ft::vector<std::string>		my3(10, "scratch");
+	std::vector<std::string>	real3(10, "scratch");
+	std::list<std::string>		lst(4, "list");
+	ft::vector<std::string>		my4(6, "other");
+	std::string					*sdata = &my3[0];
+	my3.assign(lst.begin(), lst.end());
+	real3.assign(lst.begin(), lst.end());
+	check("Assign list", (my3 == real3));
+	my3 = my4;
+	check("Assign string reuse", my3.size() == 6 && my3[5] == "other" && &my3[0] == sdata);
+	std::istringstream			in("a b c d e f g h i j k l");
+	my3.assign(std::istream_iterator<std::string>(in), std::istream_iterator<std::string>());
+	check("Assign input", my3.size() == 12 && my3[11] == "l" && my3[0] == "a");
+	my3.assign((size_t)2, my3[3]);
+	check("Assign own element", my3.size() == 2 && my3[1] == "d");
 }
 
 void	test_vct_ppback()
@@ -310,6 +372,18 @@ void	test_vct_ppback()
 	real1.pop_back();
 	real1.pop_back();
 	check("pop_back", (my1 == real1));
+
+	basic_val(my1, real1);
+	while (my1.size() < my1.capacity())
+		my1.push_back(8);
+	while (real1.size() < my1.size())
+		real1.push_back(8);
+	ft::vector<int>::size_type cap = my1.capacity();
+	my1.push_back(my1[0]);
+	real1.push_back(real1[0]);
+	check("push_back own element", (my1 == real1));
+	check("push_back growth", my1.capacity(),
+		static_cast<ft::vector<int>::size_type>(cap * FT_VECTOR_GROWTH));
 }
 
 void	test_vct_insert()
@@ -344,6 +418,15 @@ void	test_vct_insert()
 	my2.insert(--(my2.end()), (size_t)3, 4);
 	real2.insert(--(real2.end()), (size_t)3, 4);
 	check("Insert fill", (my2 == real2));
+	my2.insert(my2.begin() + 4, (size_t)1000, 8);
+	real2.insert(real2.begin() + 4, (size_t)1000, 8);
+	check("Insert fill middle", (my2 == real2));
+
+	ft::vector<char>	my4((size_t)5, 'a');
+	std::vector<char>	real4((size_t)5, 'a');
+	my4.insert(my4.begin() + 2, (size_t)33, 'b');
+	real4.insert(real4.begin() + 2, (size_t)33, 'b');
+	check("Insert fill char", (my4 == real4));
 
 	ft::vector<int> my3;
 	std::vector<int> real3;
@@ -361,6 +444,17 @@ void	test_vct_insert()
 	my3.insert(--(my3.end()), my1.begin(), my1.end());
 	real3.insert(--(real3.end()), real1.begin(), real1.end());
 	check("Insert range", (my3 == real3));
+
+	std::list<int>	lst(real3.begin(), real3.end());
+	my3.insert(my3.begin() + 2, lst.begin(), lst.end());
+	real3.insert(real3.begin() + 2, lst.begin(), lst.end());
+	check("Insert range list", (my3 == real3));
+
+	std::istringstream	in1("5 6 7 8 9");
+	std::istringstream	in2("5 6 7 8 9");
+	my3.insert(my3.begin() + 4, std::istream_iterator<int>(in1), std::istream_iterator<int>());
+	real3.insert(real3.begin() + 4, std::istream_iterator<int>(in2), std::istream_iterator<int>());
+	check("Insert range input", (my3 == real3));
 }
 
 void	test_vct_erase()
@@ -382,6 +476,10 @@ void	test_vct_erase()
 	my1.erase(my1.begin(), my1.end());
 	real1.erase(real1.begin(), real1.end());
 	check("erase range", (my1 == real1));
+
+	basic_val(my1, real1);
+	check("erase range return", *my1.erase(my1.begin() + 1, my1.begin() + 4), *real1.erase(real1.begin() + 1, real1.begin() + 4));
+	check("erase range middle", (my1 == real1));
 }
 
 void	test_vct_clear()
@@ -507,6 +605,862 @@ void	test_vct_op()
 	check("Operator >", (my1 > my2), (real1 > real2));
 }
 
+template <typename T>
+bool	same_order(const T* a, const T* b, size_t n1, size_t n2)
+{
+	return (ft::equal(a, a + n1, b) == std::equal(a, a + n1, b)
+		&& ft::lexicographical_compare(a, a + n1, b, b + n2) == std::lexicographical_compare(a, a + n1, b, b + n2)
+		&& ft::lexicographical_compare(b, b + n2, a, a + n1) == std::lexicographical_compare(b, b + n2, a, a + n1));
+}
+
+void	test_vct_op_contiguous()
+{
+	print_title("Relational operators contiguous");
+	unsigned char	uc1[40];
+	unsigned char	uc2[40];
+	char			c1[40];
+	char			c2[40];
+	signed char		sc1[40];
+	signed char		sc2[40];
+	int				i1[40];
+	int				i2[40];
+	double			d1[40];
+	double			d2[40];
+
+	for (int i = 0; i < 40; i++)
+	{
+		uc1[i] = uc2[i] = static_cast<unsigned char>(i * 7);
+		c1[i] = c2[i] = static_cast<char>(i * 7);
+		sc1[i] = sc2[i] = static_cast<signed char>(i * 7);
+		i1[i] = i2[i] = i * 7 - 100;
+		d1[i] = d2[i] = i * 0.5 - 3;
+	}
+	check("Contiguous equal", same_order(uc1, uc2, 40, 40) && same_order(c1, c2, 40, 40)
+		&& same_order(sc1, sc2, 40, 40) && same_order(i1, i2, 40, 40) && same_order(d1, d2, 40, 40));
+	check("Contiguous prefix", same_order(uc1, uc2, 40, 39) && same_order(c1, c2, 17, 40)
+		&& same_order(i1, i2, 33, 40) && same_order(d1, d2, 40, 0));
+	uc2[35] = 200;
+	c2[35] = static_cast<char>(-100);
+	sc2[35] = -100;
+	i2[35] = -1000;
+	d2[35] = -1000;
+	check("Contiguous mismatch", same_order(uc1, uc2, 40, 40) && same_order(c1, c2, 40, 40)
+		&& same_order(sc1, sc2, 40, 40) && same_order(i1, i2, 40, 40) && same_order(d1, d2, 40, 40));
+	d1[35] = 0.0;
+	d2[35] = -0.0;
+	d2[3] = std::numeric_limits<double>::quiet_NaN();
+	check("Contiguous float", same_order(d1, d2, 40, 40) && same_order(d1, d2, 3, 40));
+
+	ft::vector<int>		my1(i1, i1 + 40);
+	ft::vector<int>		my2(i2, i2 + 40);
+	std::vector<int>	real1(i1, i1 + 40);
+	std::vector<int>	real2(i2, i2 + 40);
+	check("Operator == contiguous", (my1 == my2), (real1 == real2));
+	check("Operator < contiguous", (my1 < my2), (real1 < real2));
+	check("Operator > contiguous", (my1 > my2), (real1 > real2));
+	ft::vector<double>	my3(d1, d1 + 40);
+	ft::vector<double>	my4(d1, d1 + 40);
+	check("Operator == double", (my3 == my4), true);
+}
+
+/*find / count / min / max of ft against std over [first, last)*/
+template <class It, class T>
+bool	same_search(It first, It last, const T& val)
+{
+	It	hi = first;
+	for (It it = first; it != last; ++it)
+		if (!(*it < *hi))
+			hi = it;
+	return (ft::find(first, last, val) == std::find(first, last, val)
+		&& ft::count(first, last, val) == std::count(first, last, val)
+		&& ft::min_element(first, last) == std::min_element(first, last)
+		&& ft::max_element(first, last) == std::max_element(first, last)
+		&& ft::minmax_element(first, last).first == std::min_element(first, last)
+		&& ft::minmax_element(first, last).second == hi);
+}
+
+struct	above
+{
+	int	limit;
+
+	above(int l) : limit(l) {}
+
+	bool	operator()(int x) const
+	{
+		return (x > limit);
+	}
+};
+
+/*mutable predicate counting its calls*/
+struct	counted_above
+{
+	int		limit;
+	int*	calls;
+
+	counted_above(int l, int* c) : limit(l), calls(c) {}
+
+	bool	operator()(int& x)
+	{
+		++*calls;
+		return (x > limit);
+	}
+};
+
+void	test_vct_search()
+{
+	print_title("Find / Count / Min / Max");
+	ft::vector<int>				my1;
+	ft::vector<char>			my2;
+	ft::vector<double>			my3;
+	ft::vector<unsigned char>	my4;
+	ft::vector<std::string>		my5;
+	std::list<int>				real1;
+
+	for (int i = 0; i < 1000; i++)
+	{
+		my1.push_back((i * 7919) % 613 - 300);
+		my2.push_back(static_cast<char>((i * 31) % 97));
+		my3.push_back((i % 50) * 0.25);
+		my4.push_back(static_cast<unsigned char>(i % 200));
+		real1.push_back(my1.back());
+	}
+	my5.push_back("b");
+	my5.push_back("a");
+	my5.push_back("c");
+	my5.push_back("a");
+	check("Search int", same_search(my1.begin(), my1.end(), 5) && same_search(my1.begin(), my1.end(), 1000)
+		&& same_search(my1.begin() + 3, my1.begin() + 40, -300) && same_search(my1.begin(), my1.begin(), 5));
+	check("Search char", same_search(my2.begin(), my2.end(), static_cast<char>(96))
+		&& same_search(my2.begin(), my2.end(), 'z') && same_search(&my2[0], &my2[0] + 999, static_cast<char>(0)));
+	check("Search double", same_search(my3.begin(), my3.end(), 12.25) && same_search(my3.begin(), my3.end(), 0.1));
+	check("Search list", same_search(real1.begin(), real1.end(), 5) && same_search(real1.begin(), real1.end(), 7));
+	check("Search string", same_search(my5.begin(), my5.end(), std::string("a")));
+	check("Search mixed types", ft::find(my4.begin(), my4.end(), 456) == my4.end() && ft::count(my4.begin(), my4.end(), -56) == 0
+		&& ft::count(my4.begin(), my4.end(), 199L) == 5 && ft::find(my1.begin(), my1.end(), 4294967295UL) == my1.end());
+	my3[700] = std::numeric_limits<double>::quiet_NaN();
+	check("Search NaN", same_search(my3.begin(), my3.end(), my3[700]) && same_search(my3.begin(), my3.end(), 3.0));
+	check("Find_if", ft::find_if(my1.begin(), my1.end(), above(300)) == std::find_if(my1.begin(), my1.end(), above(300))
+		&& ft::find_if(my1.begin(), my1.end(), above(1000)) == my1.end()
+		&& ft::find_if(real1.begin(), real1.end(), above(250)) == std::find_if(real1.begin(), real1.end(), above(250)));
+	int	calls = 0;
+	ft::vector<int>::iterator	hit = ft::find_if(my1.begin(), my1.end(), counted_above(300, &calls));
+	check("Find_if calls", hit == std::find_if(my1.begin(), my1.end(), above(300)) && calls == hit - my1.begin() + 1);
+	check("Min/Max compare", ft::max_element(my1.begin(), my1.end(), std::greater<int>()) == std::max_element(my1.begin(), my1.end(), std::greater<int>())
+		&& ft::minmax_element(my1.begin(), my1.begin()).second == my1.begin());
+}
+
+/*element whose copy throws once its fuse burns out, if it is armed*/
+struct	vct_fuse
+{
+	static int	fuse;
+	std::string	s;
+	bool		armed;
+
+	vct_fuse(char c, bool a = false) : s(20, c), armed(a) {}
+
+	vct_fuse(const vct_fuse& x) : s(x.s), armed(x.armed)
+	{
+		if (armed && --fuse == 0)
+			throw std::logic_error("copy");
+	}
+
+	vct_fuse&	operator=(const vct_fuse& x)
+	{
+		s = x.s;
+		armed = x.armed;
+		return (*this);
+	}
+
+	bool	operator==(const vct_fuse& x) const
+	{
+		return (s == x.s);
+	}
+};
+
+int	vct_fuse::fuse = 0;
+
+/*inserts that throw midway must leave the vector as it was*/
+template <class V, class F>
+bool	insert_rolls_back(V& v, int fuse, F insert)
+{
+	V		before(v);
+	bool	thrown = false;
+
+	vct_fuse::fuse = fuse;
+	try
+	{
+		insert(v);
+	}
+	catch (std::logic_error&)
+	{
+		thrown = true;
+	}
+	return (thrown && v.size() == before.size() && std::equal(before.begin(), before.end(), v.begin()));
+}
+
+struct	insert_range
+{
+	template <class V>
+	void	operator()(V& v) const
+	{
+		vct_fuse	src[3] = {vct_fuse('x'), vct_fuse('y', true), vct_fuse('z')};
+		v.insert(v.begin() + 2, src, src + 3);
+	}
+};
+
+struct	insert_fill
+{
+	template <class V>
+	void	operator()(V& v) const
+	{
+		v.insert(v.begin() + 2, 5, vct_fuse('q', true));
+	}
+};
+
+struct	insert_one
+{
+	template <class V>
+	void	operator()(V& v) const
+	{
+		v.insert(v.begin() + 1, vct_fuse('o', true));
+	}
+};
+
+void	test_vct_non_trivial()
+{
+	print_title("Non trivial elements");
+	ft::vector<std::string>		my1;
+	std::vector<std::string>	real1;
+
+	for (int i = 0; i < 20; i++)
+	{
+		my1.push_back(std::string(i + 20, 'a' + i));
+		real1.push_back(std::string(i + 20, 'a' + i));
+	}
+	my1.insert(my1.begin() + 5, std::string(30, 'z'));
+	real1.insert(real1.begin() + 5, std::string(30, 'z'));
+	check("Insert middle", (my1 == real1));
+	my1.insert(my1.begin() + 2, my1[10]);
+	real1.insert(real1.begin() + 2, real1[10]);
+	check("Insert own element", (my1 == real1));
+	my1.erase(my1.begin() + 3);
+	real1.erase(real1.begin() + 3);
+	check("Erase middle", (my1 == real1));
+	my1.reserve(100);
+	real1.reserve(100);
+	check("Reserve", (my1 == real1));
+	my1.erase(my1.begin() + 2, my1.begin() + 9);
+	real1.erase(real1.begin() + 2, real1.begin() + 9);
+	check("Erase range middle", (my1 == real1));
+	my1.resize(6);
+	real1.resize(6);
+	check("Resize smaller", (my1 == real1));
+	my1.insert(my1.begin() + 3, 40, my1[1]);
+	real1.insert(real1.begin() + 3, 40, real1[1]);
+	check("Insert fill own element", (my1 == real1));
+
+	ft::vector<std::string>		my2;
+	std::vector<std::string>	real2;
+	my2.push_back("x");
+	real2.push_back("x");
+	my2 = my1;
+	real2 = real1;
+	check("Assignation", (my2 == real2));
+	my1 = my2;
+	real1 = real2;
+	check("Assignation", (my1 == real1));
+
+	ft::vector<vct_fuse>	my3;
+	for (int i = 0; i < 10; i++)
+		my3.push_back(vct_fuse('a' + i));
+	ft::vector<vct_fuse>	my4(my3);
+	my3.reserve(40);
+	check("Insert range throw", insert_rolls_back(my3, 1, insert_range()));
+	check("Insert fill throw", insert_rolls_back(my3, 3, insert_fill()));
+	check("Insert realloc throw", insert_rolls_back(my4, 1, insert_range()) && insert_rolls_back(my4, 3, insert_fill()));
+	check("Insert one throw", insert_rolls_back(my3, 2, insert_one()));
+
+	ft::small_vector<vct_fuse, 4>	my5;
+	for (int i = 0; i < 3; i++)
+		my5.push_back(vct_fuse('a' + i));
+	ft::small_vector<vct_fuse, 4>	my6(my5);
+	my5.reserve(40);
+	check("Small insert throw", insert_rolls_back(my5, 1, insert_range()) && insert_rolls_back(my5, 3, insert_fill())
+		&& insert_rolls_back(my5, 2, insert_one()));
+	check("Small spill throw", insert_rolls_back(my6, 1, insert_range()) && insert_rolls_back(my6, 3, insert_fill()));
+	bool	thrown = false;
+	vct_fuse::fuse = 4;
+	try
+	{
+		ft::small_vector<vct_fuse, 4>	my7(6, vct_fuse('c', true));
+	}
+	catch (std::logic_error&)
+	{
+		thrown = true;
+	}
+	check("Small construct throw", thrown);
+}
+
+void	test_small_vector()
+{
+	print_title("Small vector");
+	ft::small_vector<std::string, 4>	my1;
+	std::vector<std::string>			real1;
+
+	for (int i = 0; i < 3; i++)
+	{
+		my1.push_back(std::string(i + 20, 'a' + i));
+		real1.push_back(std::string(i + 20, 'a' + i));
+	}
+	check("Small push_back", std::equal(real1.begin(), real1.end(), my1.begin()) && my1.size() == real1.size());
+	check("Small inline", my1.is_small(), true);
+	check("Small capacity", my1.capacity(), (size_t)4);
+	my1.insert(my1.begin() + 1, "mid");
+	real1.insert(real1.begin() + 1, "mid");
+	check("Small insert", std::equal(real1.begin(), real1.end(), my1.begin()), true);
+	check("Small inline full", my1.is_small(), true);
+	my1.push_back(my1[0]);
+	real1.push_back(real1[0]);
+	check("Small spill", my1.is_small(), false);
+	check("Small spill", std::equal(real1.begin(), real1.end(), my1.begin()) && my1.size() == real1.size());
+	my1.insert(my1.begin() + 2, 3, "three");
+	real1.insert(real1.begin() + 2, 3, "three");
+	my1.erase(my1.begin(), my1.begin() + 2);
+	real1.erase(real1.begin(), real1.begin() + 2);
+	check("Small erase", std::equal(real1.begin(), real1.end(), my1.begin()) && my1.size() == real1.size());
+
+	ft::small_vector<std::string, 4>	my2(my1);
+	check("Small copy", (my2 == my1), true);
+	ft::small_vector<std::string, 4>	my3(2, "x");
+	my3.swap(my1);
+	check("Small swap inline", my1.is_small(), true);
+	check("Small swap inline", my1.size(), (size_t)2);
+	check("Small swap heap", (my3 == my2), true);
+	my2.clear();
+	my2.resize(3, "r");
+	check("Small resize", my2.back(), std::string("r"));
+	check("Small at", my3.at(0), real1.at(0));
+	check("Small compare", (my1 < my3), (my1.front() < my3.front()));
+
+	ft::small_vector<int, 8>	my4;
+	for (int i = 0; i < 100; i++)
+		my4.push_back(i);
+	int sum = 0;
+	for (ft::small_vector<int, 8>::const_iterator it = my4.begin(); it != my4.end(); ++it)
+		sum += *it;
+	check("Small int", sum, 4950);
+	my4.resize(5);
+	my4.shrink_to_fit();
+	check("Small shrink to fit", my4.is_small() && my4.size() == 5 && my4[4] == 4);
+	check("Small memory usage", my4.memory_usage(), sizeof(my4));
+}
+
+void	test_soa_vector()
+{
+	print_title("Soa vector");
+	ft::soa_vector<int, std::string, double>	my1;
+	std::vector<int>							real0;
+	std::vector<std::string>					real1;
+
+	check("Soa empty", my1.empty() && my1.column<0>().empty() && my1.column<1>().data() == NULL);
+	for (int i = 0; i < 1000; i++)
+	{
+		my1.push_back(i, std::string(i % 30 + 1, 'a' + i % 26), i * 0.5);
+		real0.push_back(i);
+		real1.push_back(std::string(i % 30 + 1, 'a' + i % 26));
+	}
+	ft::soa_span<int>			c0 = my1.column<0>();
+	ft::soa_span<std::string>	c1 = my1.column<1>();
+	check("Soa push_back", my1.size() == 1000 && c0.size() == 1000 && c1.size() == 1000);
+	check("Soa column", std::equal(real0.begin(), real0.end(), c0.begin()) && std::equal(real1.begin(), real1.end(), c1.begin()));
+	check("Soa get", my1.get<2>(10), 5.0);
+	my1.get<0>(10) = -1;
+	check("Soa span write", c0[10], -1);
+	double	sum = 0;
+	ft::soa_span<const double>	c2 = my1.column<2>();
+	for (const double* it = c2.begin(); it != c2.end(); ++it)
+		sum += *it;
+	check("Soa column scan", sum, 999 * 1000 * 0.25);
+	my1.erase(0);
+	real1.erase(real1.begin());
+	check("Soa erase", my1.size() == 999 && my1.get<0>(0) == 1 && std::equal(real1.begin(), real1.end(), my1.column<1>().begin()));
+	my1.pop_back();
+	check("Soa pop_back", my1.size() == 998 && my1.get<1>(997) == real1[997]);
+	my1.resize(1200);
+	check("Soa resize", my1.get<0>(1100) == 0 && my1.get<1>(1100).empty() && my1.capacity() >= 1200);
+
+	const ft::soa_vector<int, std::string, double>	my2(my1);
+	check("Soa copy", my2.size() == my1.size() && my2.get<1>(5) == my1.get<1>(5) && my2.column<0>().data() != my1.column<0>().data());
+	ft::soa_vector<int, std::string, double>	my3;
+	my3.push_back(7, "seven");
+	swap(my1, my3);
+	check("Soa swap", my1.size() == 1 && my1.get<1>(0) == "seven" && my3.size() == 1200);
+	my3.clear();
+	my3.shrink_to_fit();
+	check("Soa shrink", my3.capacity() == 0 && my3.wasted_bytes() == 0 && my3.memory_usage() == sizeof(my3));
+
+	ft::soa_vector<float, char, short, int, ft::aligned_allocator<char, 64> >	my4(100);
+	check("Soa aligned", reinterpret_cast<size_t>(my4.column<1>().data()) % 64 == 0 && reinterpret_cast<size_t>(my4.column<3>().data()) % 64 == 0);
+	try
+	{
+		my4.erase(100);
+		check("Soa erase OOB", false);
+	}
+	catch (std::out_of_range&)
+	{
+		check("Soa erase OOB", true);
+	}
+}
+
+template <typename Bits>
+static bool	same_bits(const Bits& a, const std::vector<bool>& b)
+{
+	if (a.size() != b.size() || a.empty() != b.empty())
+		return (false);
+	for (size_t i = 0; i < a.size(); i++)
+		if (a[i] != b[i])
+			return (false);
+	return (true);
+}
+
+void	test_bitvector()
+{
+	print_title("Bitvector");
+	ft::bitvector<>		my1;
+	std::vector<bool>	real1;
+
+	for (int i = 0; i < 1000; i++)
+	{
+		my1.push_back(i % 3 == 0 || i % 7 == 0);
+		real1.push_back(i % 3 == 0 || i % 7 == 0);
+	}
+	check("Bits push_back", same_bits(my1, real1));
+	check("Bits packed", my1.num_words(), (size_t)16);
+	check("Bits count", my1.count(), (size_t)std::count(real1.begin(), real1.end(), true));
+	my1[1] = true;
+	real1[1] = true;
+	my1[3] = my1[2];
+	real1[3] = real1[2];
+	my1.flip(5);
+	real1[5].flip();
+	check("Bits reference", same_bits(my1, real1));
+	for (int i = 0; i < 300; i++)
+	{
+		my1.pop_back();
+		real1.pop_back();
+	}
+	check("Bits pop_back", same_bits(my1, real1) && my1.count() == (size_t)std::count(real1.begin(), real1.end(), true));
+	my1.resize(900, true);
+	real1.resize(900, true);
+	my1.resize(850);
+	real1.resize(850);
+	check("Bits resize", same_bits(my1, real1) && my1.count() == (size_t)std::count(real1.begin(), real1.end(), true));
+
+	std::vector<size_t>	set1;
+	std::vector<size_t>	set2;
+	for (size_t i = my1.find_first(); i != my1.npos; i = my1.find_next(i))
+		set1.push_back(i);
+	for (size_t i = 0; i < real1.size(); i++)
+		if (real1[i])
+			set2.push_back(i);
+	check("Bits find_next", set1 == set2);
+	ft::bitvector<>	my2(850);
+	check("Bits find none", my2.find_first() == my2.npos && my2.none() && !my2.any());
+	my2.set(64).set(700);
+	check("Bits find sparse", my2.find_first() == 64 && my2.find_next(64) == 700 && my2.find_next(700) == my2.npos);
+
+	std::vector<bool>	real2(850);
+	real2[64] = true;
+	real2[700] = true;
+	ft::bitvector<>	my3 = my1 & my2;
+	std::vector<bool>	real3(850);
+	for (size_t i = 0; i < 850; i++)
+		real3[i] = real1[i] && real2[i];
+	check("Bits and", same_bits(my3, real3));
+	my3 = my1 | my2;
+	for (size_t i = 0; i < 850; i++)
+		real3[i] = real1[i] || real2[i];
+	check("Bits or", same_bits(my3, real3));
+	my3 ^= my2;
+	for (size_t i = 0; i < 850; i++)
+		real3[i] = real3[i] != real2[i];
+	check("Bits xor", same_bits(my3, real3));
+	my3 = ~my1;
+	check("Bits not", my3.count() + my1.count() == 850 && (my3 | my1).all() && !my3.all());
+	try
+	{
+		my3 &= ft::bitvector<>(10);
+		check("Bits size mismatch", false);
+	}
+	catch (std::length_error&)
+	{
+		check("Bits size mismatch", true);
+	}
+
+	ft::bitvector<>	my4(my1);
+	check("Bits copy", (my4 == my1) && !(my4 != my1));
+	my4.flip(849);
+	check("Bits compare", (my4 != my1));
+	my4.swap(my2);
+	check("Bits swap", my2.size() == 850 && my4.count() == 2);
+	std::vector<bool>	real5(real1.rbegin(), real1.rend());
+	check("Bits reverse_iterator", std::equal(real5.begin(), real5.end(), my1.rbegin()));
+	ft::bitvector<>::const_iterator	it = my1.begin();
+	check("Bits iterator", *(it + 9) == real1[9] && my1.end() - it == 850 && it[21] == real1[21]);
+	ft::bitvector<>	my6(130, true);
+	check("Bits all", my6.all() && my6.count() == 130);
+	my6.set();
+	my6.push_back(false);
+	check("Bits set", my6.count() == 130 && !my6.all() && my6.back() == false);
+	my6.reset();
+	check("Bits reset", my6.none() && my6.size() == 131);
+	check("Bits memory", my6.memory_usage() < 131);
+}
+
+void	test_mmap_vector()
+{
+	print_title("Mmap vector");
+	const char*			path = "/tmp/ft_containers_test.vec";
+	std::vector<long>	real1;
+
+	std::remove(path);
+	{
+		ft::mmap_vector<long>	my1(path, ft::mmap_vector<long>::ACCESS_SEQUENTIAL);
+		check("File empty", my1.empty() && my1.capacity() > 0);
+		for (long i = 0; i < 100000; i++)
+		{
+			my1.push_back(i * 7);
+			real1.push_back(i * 7);
+		}
+		check("File push_back", my1.size() == real1.size() && std::equal(real1.begin(), real1.end(), my1.begin()));
+		my1.insert(my1.begin() + 10, 3000, -1);
+		real1.insert(real1.begin() + 10, 3000, -1);
+		my1.insert(my1.begin(), 42);
+		real1.insert(real1.begin(), 42);
+		my1.erase(my1.begin() + 500, my1.begin() + 1500);
+		real1.erase(real1.begin() + 500, real1.begin() + 1500);
+		check("File insert / erase", my1.size() == real1.size() && std::equal(real1.begin(), real1.end(), my1.begin()));
+		my1.resize(real1.size() + 5, 9);
+		real1.resize(real1.size() + 5, 9);
+		my1.advise(ft::mmap_vector<long>::ACCESS_RANDOM);
+		my1.sync();
+		check("File sync", my1.back(), 9L);
+		check("File at", my1.at(1), real1.at(1));
+	}
+	{
+		ft::mmap_vector<long>	my2(path);
+		check("File reopen", my2.size() == real1.size() && std::equal(real1.begin(), real1.end(), my2.begin()));
+		my2.pop_back();
+		real1.pop_back();
+		my2.shrink_to_fit();
+		check("File shrink", my2.capacity() >= my2.size() && my2.capacity() - my2.size() < 4096 / sizeof(long));
+		ft::mmap_vector<long>	my3("/tmp/ft_containers_test2.vec");
+		my3.push_back(1);
+		my3.swap(my2);
+		check("File swap", my2.size() == 1 && my3.size() == real1.size() && my3.path() == path);
+		std::remove("/tmp/ft_containers_test2.vec");
+	}
+	try
+	{
+		ft::mmap_vector<int>	bad(path);
+		check("File wrong type", false);
+	}
+	catch (std::runtime_error&)
+	{
+		check("File wrong type", true);
+	}
+	{
+		ft::mmap_vector<long>	my4(path);
+		check("File persisted", my4.size() == real1.size() && std::equal(real1.rbegin(), real1.rend(), my4.rbegin()));
+		my4.clear();
+	}
+	{
+		ft::mmap_vector<long>	my5(path);
+		check("File cleared", my5.empty());
+	}
+	typedef ft::mmap_vector<long>::size_type	size_type;
+	size_type	count = std::numeric_limits<size_type>::max() / sizeof(long) + 1;
+	std::fstream	file(path, std::ios::in | std::ios::out | std::ios::binary);
+	file.seekp(8 + sizeof(size_type));
+	file.write(reinterpret_cast<const char*>(&count), sizeof(count));
+	file.close();
+	try
+	{
+		ft::mmap_vector<long>	bad(path);
+		check("File count overflow", false);
+	}
+	catch (std::runtime_error&)
+	{
+		check("File count overflow", true);
+	}
+	std::remove(path);
+}
+
+/*appended by every producer thread of test_concurrent_vector*/
+struct	cv_job
+{
+	ft::concurrent_vector<long>*	vct;
+	long							id;
+	long							n;
+	bool							ok;
+};
+
+/*value the producer id appends as its i-th element*/
+static long		cv_value(long id, long i, long n)
+{
+	if (id % 2 && i / 7 * 7 + 7 <= n)
+		return (id * 1000000 + i / 7 * 7);
+	return (id * 1000000 + i);
+}
+
+/*odd producers append batches of 7 copies with grow_by, even ones push_back*/
+static void*	cv_producer(void* arg)
+{
+	cv_job*	job = static_cast<cv_job*>(arg);
+
+	for (long i = 0; i < job->n; i++)
+	{
+		if (job->id % 2 && i + 7 <= job->n)
+		{
+			job->vct->grow_by(7, cv_value(job->id, i, job->n));
+			i += 6;
+		}
+		else
+			job->vct->push_back(cv_value(job->id, i, job->n));
+	}
+	return (NULL);
+}
+
+/*checks that every published element is constructed while producers run*/
+static void*	cv_reader(void* arg)
+{
+	cv_job*	job = static_cast<cv_job*>(arg);
+
+	job->ok = true;
+	while (job->vct->size() < static_cast<size_t>(job->n))
+	{
+		size_t	n = job->vct->size();
+		long	v = n ? (*job->vct)[n - 1] : 0;
+		if (v < 0 || v / 1000000 > 3 || v % 1000000 >= 20000)
+			job->ok = false;
+	}
+	return (NULL);
+}
+
+struct	cv_throw
+{
+	int	v;
+
+	explicit cv_throw(int x) : v(x) {}
+
+	cv_throw(const cv_throw& x) : v(x.v)
+	{
+		if (v == 13)
+			throw std::logic_error("copy");
+	}
+};
+
+void	test_concurrent_vector()
+{
+	print_title("Concurrent vector");
+	ft::concurrent_vector<long>	my1;
+	std::vector<long>			real1;
+
+	check("Concurrent empty", my1.empty() && my1.begin() == my1.end());
+	for (long i = 0; i < 5000; i++)
+	{
+		my1.push_back(i * 3);
+		real1.push_back(i * 3);
+	}
+	long*	first = &my1[0];
+	long*	mid = &my1[2500];
+	my1.grow_by(3000, 7);
+	real1.insert(real1.end(), 3000, 7);
+	check("Concurrent push_back", my1.size() == real1.size() && std::equal(real1.begin(), real1.end(), my1.begin()));
+	check("Concurrent stable", first == &my1[0] && mid == &my1[2500] && *mid == 7500);
+	check("Concurrent iterators", my1.end() - my1.begin(), static_cast<long>(real1.size()));
+	check("Concurrent reverse", std::equal(real1.rbegin(), real1.rend(), my1.rbegin()));
+	check("Concurrent at", my1.at(4999), real1.at(4999));
+	check("Concurrent capacity", my1.capacity() >= my1.size());
+	ft::concurrent_vector<long>	my2(my1);
+	check("Concurrent copy", my2.size() == real1.size() && std::equal(real1.begin(), real1.end(), my2.begin()));
+	my2.clear();
+	my2.reserve(100);
+	check("Concurrent clear", my2.empty() && my2.capacity() >= 100);
+	bool	thrown = false;
+	try
+	{
+		my1.at(real1.size());
+	}
+	catch (std::out_of_range&)
+	{
+		thrown = true;
+	}
+	check("Concurrent at OOB", thrown);
+	ft::concurrent_vector<char, std::allocator<char>, 4>	my5;
+	std::string												real5;
+	for (int i = 0; i < 3000; i++)
+	{
+		my5.grow_by(i % 3 + 1, static_cast<char>('a' + i % 26));
+		real5.append(i % 3 + 1, static_cast<char>('a' + i % 26));
+	}
+	check("Concurrent small segs", my5.size() == real5.size() && std::equal(real5.begin(), real5.end(), my5.begin()));
+
+	ft::concurrent_vector<long>	my3;
+	pthread_t					threads[5];
+	cv_job						jobs[5];
+	const long					n = 20000;
+	for (long t = 0; t < 5; t++)
+	{
+		jobs[t].vct = &my3;
+		jobs[t].id = t;
+		jobs[t].n = t < 4 ? n : 4 * n;
+		jobs[t].ok = true;
+	}
+	pthread_create(&threads[4], NULL, &cv_reader, &jobs[4]);
+	for (long t = 0; t < 4; t++)
+		pthread_create(&threads[t], NULL, &cv_producer, &jobs[t]);
+	for (long t = 0; t < 5; t++)
+		pthread_join(threads[t], NULL);
+	long	next[4] = {0, 0, 0, 0};
+	bool	ordered = my3.size() == static_cast<size_t>(4 * n);
+	for (ft::concurrent_vector<long>::iterator it = my3.begin(); ordered && it != my3.end(); ++it)
+	{
+		long	id = *it / 1000000;
+		ordered = id >= 0 && id < 4 && *it == cv_value(id, next[id]++, n);
+	}
+	check("Concurrent threads", ordered);
+	check("Concurrent readers", jobs[4].ok);
+
+	ft::concurrent_vector<cv_throw>	my4;
+	my4.push_back(cv_throw(1));
+	thrown = false;
+	try
+	{
+		my4.grow_by(3, cv_throw(13));
+	}
+	catch (std::logic_error&)
+	{
+		thrown = true;
+	}
+	my4.push_back(cv_throw(2));
+	check("Concurrent throw", thrown && my4.size() == 5 && !my4.dead(0) && my4.dead(1) && my4.dead(3) && my4[4].v == 2);
+	thrown = false;
+	try
+	{
+		my4.at(2);
+	}
+	catch (std::out_of_range&)
+	{
+		thrown = true;
+	}
+	check("Concurrent dead at", thrown);
+	ft::concurrent_vector<cv_throw>	my6(my4);
+	check("Concurrent dead copy", my6.size() == 5 && my6.dead(2) && !my6.dead(4) && my6[4].v == 2);
+	thrown = false;
+	try
+	{
+		my1.grow_by(my1.max_size());
+	}
+	catch (std::length_error&)
+	{
+		thrown = true;
+	}
+	my1.push_back(1);
+	check("Concurrent length", thrown && my1.size() == real1.size() + 1 && my1.back() == 1);
+}
+
+void	test_vct_mmap_alloc()
+{
+	print_title("Mmap allocator");
+	ft::vector<unsigned long, ft::mmap_allocator<unsigned long> >	my1;
+	std::vector<unsigned long>										real1;
+
+	for (unsigned long i = 0; i < 10; i++)
+	{
+		my1.push_back(i * 3);
+		real1.push_back(i * 3);
+	}
+	check("Mmap small", std::equal(real1.begin(), real1.end(), my1.begin()) && my1.size() == real1.size());
+	for (unsigned long i = 0; i < 300000; i++)
+	{
+		my1.push_back(i ^ 0x5a5a);
+		real1.push_back(i ^ 0x5a5a);
+	}
+	check("Mmap grow", std::equal(real1.begin(), real1.end(), my1.begin()) && my1.size() == real1.size());
+	my1.reserve(my1.capacity() * 4);
+	check("Mmap reserve", std::equal(real1.begin(), real1.end(), my1.begin()), true);
+	my1.insert(my1.begin() + 5, 70000, 9);
+	real1.insert(real1.begin() + 5, 70000, 9);
+	my1.insert(my1.begin() + 1, 11ul);
+	real1.insert(real1.begin() + 1, 11ul);
+	my1.erase(my1.begin() + 100, my1.begin() + 200);
+	real1.erase(real1.begin() + 100, real1.begin() + 200);
+	check("Mmap insert / erase", std::equal(real1.begin(), real1.end(), my1.begin()) && my1.size() == real1.size());
+
+	ft::vector<unsigned long, ft::mmap_allocator<unsigned long> >	my2(my1);
+	my2.push_back(my2[0]);
+	check("Mmap copy", my2.back(), real1.front());
+	my1.swap(my2);
+	check("Mmap swap", my1.size(), real1.size() + 1);
+}
+
+void	test_vct_aligned_alloc()
+{
+	print_title("Aligned allocator");
+	ft::vector<float, ft::aligned_allocator<float, 64> >	my1;
+	std::vector<float>										real1;
+	bool													aligned = true;
+
+	check("Aligned empty", my1.alignment(), (size_t)64);
+	for (int i = 0; i < 1000; i++)
+	{
+		my1.push_back(i * 0.5f);
+		real1.push_back(i * 0.5f);
+		if (reinterpret_cast<size_t>(&my1[0]) % 64 || my1.alignment() < 64)
+			aligned = false;
+	}
+	check("Aligned growth", aligned);
+	check("Aligned values", std::equal(real1.begin(), real1.end(), my1.begin()) && my1.size() == real1.size());
+	my1.insert(my1.begin() + 3, 500, 2.0f);
+	real1.insert(real1.begin() + 3, 500, 2.0f);
+	check("Aligned insert", std::equal(real1.begin(), real1.end(), my1.begin()) && reinterpret_cast<size_t>(&my1[0]) % 64 == 0);
+	ft::vector<double, ft::aligned_allocator<double, 4096> >	my2(10, 1.0);
+	check("Aligned page", reinterpret_cast<size_t>(&my2[0]) % 4096, (size_t)0);
+}
+
+#if __cplusplus >= 201103L
+void	test_vct_move()
+{
+	print_title("Move / Emplace");
+	ft::vector<std::string>		my1;
+	std::vector<std::string>	real1;
+
+	for (int i = 0; i < 10; i++)
+	{
+		my1.emplace_back(i + 10, 'a' + i);
+		real1.emplace_back(i + 10, 'a' + i);
+	}
+	check("Emplace_back", (my1 == real1));
+	my1.emplace(my1.begin() + 3, 5, 'z');
+	real1.emplace(real1.begin() + 3, 5, 'z');
+	check("Emplace", (my1 == real1));
+	std::string	s1(40, 'm');
+	std::string	s2(40, 'm');
+	my1.push_back(std::move(s1));
+	real1.push_back(std::move(s2));
+	check("Push_back rvalue", (my1 == real1));
+
+	ft::vector<std::string>		my2(std::move(my1));
+	std::vector<std::string>	real2(std::move(real1));
+	check("Move constructor", (my2 == real2));
+	check("Move constructor source", my1.size(), (size_t)0);
+	my1 = std::move(my2);
+	real1 = std::move(real2);
+	check("Move assignation", (my1 == real1));
+}
+
+#endif
 void	test_vector()
 {
 	print_header("VECTOR");
@@ -532,4 +1486,28 @@ void	test_vector()
 	P("");
 	test_vct_op();
 	P("");
+	test_vct_op_contiguous();
+	P("");
+	test_vct_search();
+	P("");
+	test_vct_non_trivial();
+	P("");
+	test_small_vector();
+	P("");
+	test_soa_vector();
+	P("");
+	test_bitvector();
+	P("");
+	test_mmap_vector();
+	P("");
+	test_concurrent_vector();
+	P("");
+	test_vct_mmap_alloc();
+	P("");
+	test_vct_aligned_alloc();
+	P("");
+#if __cplusplus >= 201103L
+	test_vct_move();
+	P("");
+#endif
 }
@@ -12,7 +12,17 @@
 # include <map>
 # include <utility>
 
+# include "../bitvector.hpp"
+# include "../concurrent_vector.hpp"
+# include "../deque.hpp"
 # include "../map.hpp"
+# include "../mmap_map.hpp"
+# include "../mmap_vector.hpp"
+# include "../parallel.hpp"
+# include "../small_map.hpp"
+# include "../small_vector.hpp"
+# include "../soa_vector.hpp"
+# include "../interval_map.hpp"
 # include "../stack.hpp"
 # include "../utils.hpp"
 # include "../vector.hpp"
@@ -32,9 +42,11 @@
 
 void	test_list();
 void	test_stack();
+void	test_deque();
 void	test_vector();
 void	test_queue();
 void	test_map();
+void	test_par();
 
 bool compare_supEq(int a, int b);
 bool compare_infEq(int a, int b);
@@ -76,6 +88,40 @@ inline void check(std::string name, bool good)
 		std::cout << name << ": " << margin << BOLD << RED << FAIL << RESET << std::endl;
 };
 
+inline int*	tagged_count()
+{
+	static int	count[8];
+	return (count);
+}
+
+/*allocator carrying a tag; counts the elements each tag holds*/
+template <class T>
+struct	tagged_allocator : public std::allocator<T>
+{
+	template <class U> struct	rebind
+	{
+		typedef tagged_allocator<U>	other;
+	};
+
+	int	tag;
+
+	tagged_allocator(int t = 0) : tag(t) {}
+
+	template <class U> tagged_allocator(const tagged_allocator<U>& x) : std::allocator<T>(x), tag(x.tag) {}
+
+	T*	allocate(size_t n, const void* = 0)
+	{
+		tagged_count()[tag] += n;
+		return (std::allocator<T>::allocate(n));
+	}
+
+	void	deallocate(T* p, size_t n)
+	{
+		tagged_count()[tag] -= n;
+		std::allocator<T>::deallocate(p, n);
+	}
+};
+
 template <typename T>
 bool operator==(ft::vector<T> &a, std::vector<T> &b)
 {
@@ -137,4 +183,4 @@ bool operator==(ft::map<T, S> &a, std::map<T, S> &b)
 // 	return (true);
 // };
 
-#endif
\ No newline at end of file
+#endif
\ No newline at end of file
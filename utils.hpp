@@ -2,6 +2,22 @@
 # define UTILS_HPP
 
 # include <cstddef>
+# include <cstring>
+# include <iterator>
+# if __cplusplus >= 201103L
+#  include <type_traits>
+#  include <utility>
+# endif
+
+/*
+** Marks rarely taken slow paths (reallocation, new blocks) so they stay out
+** of line and out of the hot loop.
+*/
+# if defined(__GNUC__)
+#  define FT_COLD __attribute__((cold, noinline))
+# else
+#  define FT_COLD
+# endif
 
 namespace ft
 {
@@ -25,7 +41,7 @@ namespace ft
 
 	template<class T, T v> struct				integral_constant
 	{
-		static const bool				value = v;
+		static const T					value = v;
 		typedef T						value_type;
 		typedef integral_constant<T, v>	type;
 		operator						T() const
@@ -37,8 +53,10 @@ namespace ft
 	template<typename> struct					is_integral_type : public integral_constant<bool, false> {};
 	template<> struct							is_integral_type<bool> : public integral_constant<bool, true> {};
 	template<> struct							is_integral_type<char> : public integral_constant<char, true> {};
+# if __cplusplus >= 201103L || defined(_LIBCPP_VERSION)
 	template<> struct							is_integral_type<char16_t> : public integral_constant<char16_t, true> {};
 	template<> struct							is_integral_type<char32_t> : public integral_constant<char32_t, true> {};
+# endif
 	template<> struct							is_integral_type<wchar_t> : public integral_constant<wchar_t, true> {};
 	template<> struct							is_integral_type<signed char> : public integral_constant<signed char, true> {};
 	template<> struct							is_integral_type<short int> : public integral_constant<short int, true> {};
@@ -51,11 +69,150 @@ namespace ft
 
 	template<typename T> struct					is_integral : public is_integral_type<T> {};
 
+	/*****************************************/
+	/* IS_SAME & IS_TRIVIALLY_COPYABLE       */
+	/*****************************************/
+
+	template<class T, class U> struct			is_same : public integral_constant<bool, false> {};
+	template<class T> struct					is_same<T, T> : public integral_constant<bool, true> {};
+
+	template<typename T> struct					is_pointer : public integral_constant<bool, false> {};
+	template<typename T> struct					is_pointer<T*> : public integral_constant<bool, true> {};
+
+	template<typename T> struct					is_floating_point : public integral_constant<bool, false> {};
+	template<> struct							is_floating_point<float> : public integral_constant<bool, true> {};
+	template<> struct							is_floating_point<double> : public integral_constant<bool, true> {};
+	template<> struct							is_floating_point<long double> : public integral_constant<bool, true> {};
+
+	template<typename T> struct					remove_const
+	{
+		typedef T	type;
+	};
+	template<typename T> struct					remove_const<const T>
+	{
+		typedef T	type;
+	};
+
+	/*
+	** Types whose objects can be copied with memcpy and need no destructor
+	** call. Without compiler support only scalars are assumed to qualify.
+	*/
+# if defined(__GNUC__) || defined(__clang__)
+	template<typename T> struct					is_trivially_copyable : public integral_constant<bool, __is_trivially_copyable(T)> {};
+# else
+	template<typename T> struct					is_trivially_copyable : public integral_constant<bool, is_integral<T>::value || is_pointer<T>::value> {};
+# endif
+
+	/*
+	** Types whose default constructor does nothing, so default-initialized
+	** objects may be left as raw memory. __has_trivial_constructor is
+	** deprecated on recent clang; compilers without the newer builtin fall
+	** back to __is_trivial.
+	*/
+# ifdef __has_builtin
+#  if __has_builtin(__is_trivially_constructible)
+#   define FT_HAS_IS_TRIVIALLY_CONSTRUCTIBLE
+#  endif
+# endif
+# if defined(FT_HAS_IS_TRIVIALLY_CONSTRUCTIBLE)
+	template<typename T> struct					is_trivially_default_constructible : public integral_constant<bool, __is_trivially_constructible(T)> {};
+# elif defined(__GNUC__) || defined(__clang__)
+	template<typename T> struct					is_trivially_default_constructible : public integral_constant<bool, __is_trivial(T)> {};
+# else
+	template<typename T> struct					is_trivially_default_constructible : public integral_constant<bool, is_integral<T>::value || is_pointer<T>::value> {};
+# endif
+
+	/*
+	** Compile-time assertion: static_check<false> is incomplete, so taking
+	** its size in a class member stops the build where the class is used.
+	*/
+	template<bool Cond> struct					static_check;
+	template<> struct							static_check<true> {};
+
 	/***********************************/
 	/* EQUAL & LEXICOGRAPHICAL_COMPARE */
 	/***********************************/
 
-	template<class InputIterator1, class InputIterator2> bool							equal(InputIterator1 first1, InputIterator1 last1, InputIterator2 first2)
+	/*
+	** Iterators over contiguous memory, so &*it addresses the whole range:
+	** raw pointers here, vector_iterator further down.
+	*/
+	template<class It> struct					contiguous_iterator : public integral_constant<bool, false>
+	{
+		typedef void	value_type;
+	};
+
+	template<class T> struct					contiguous_iterator<T*> : public integral_constant<bool, true>
+	{
+		typedef typename remove_const<T>::type	value_type;
+	};
+
+	/*
+	** How two iterator types can be compared: element by element, as raw
+	** bytes with memcmp, or with the block mismatch kernel. Both sides must
+	** be contiguous over the same type. Equality is bitwise for integers and
+	** pointers, but ordering is only for unsigned bytes (memcmp's order);
+	** the remaining arithmetic types, floats included, use the kernel.
+	*/
+	enum										compare_kind
+	{
+		COMPARE_GENERIC,
+		COMPARE_MEMCMP,
+		COMPARE_KERNEL
+	};
+
+	template<class It1, class It2> struct		compare_dispatch
+	{
+		typedef typename contiguous_iterator<It1>::value_type	T;
+		static const bool	same = contiguous_iterator<It1>::value && contiguous_iterator<It2>::value
+			&& is_same<T, typename contiguous_iterator<It2>::value_type>::value;
+		static const bool	arithmetic = is_integral<T>::value || is_floating_point<T>::value;
+		static const bool	unsigned_bytes = is_same<T, unsigned char>::value || is_same<T, bool>::value
+			|| (is_same<T, char>::value && static_cast<char>(-1) > 0);
+		static const int	equal = !same ? COMPARE_GENERIC : (is_integral<T>::value || is_pointer<T>::value) ? COMPARE_MEMCMP
+			: arithmetic ? COMPARE_KERNEL : COMPARE_GENERIC;
+		static const int	less = !same ? COMPARE_GENERIC : unsigned_bytes ? COMPARE_MEMCMP : arithmetic ? COMPARE_KERNEL : COMPARE_GENERIC;
+	};
+
+	template<class T> struct					differ
+	{
+		static bool	test(const T& a, const T& b)
+		{
+			return (!(a == b));
+		}
+	};
+
+	template<class T> struct					ordered_apart
+	{
+		static bool	test(const T& a, const T& b)
+		{
+			return ((a < b) | (b < a));
+		}
+	};
+
+	/*
+	** First index below n where Pred holds, n if none. Blocks of 16 are
+	** tested without branching so the compiler can turn them into SIMD
+	** compares; only the block holding the hit is rescanned.
+	*/
+	template<class Pred, class T> size_t		mismatch_index(const T* a, const T* b, size_t n)
+	{
+		size_t	i = 0;
+		for (; i + 16 <= n; i += 16)
+		{
+			int	d = 0;
+			for (size_t j = 0; j < 16; j++)
+				d |= Pred::test(a[i + j], b[i + j]);
+			if (d)
+				break ;
+		}
+		for (; i < n; i++)
+			if (Pred::test(a[i], b[i]))
+				return (i);
+		return (n);
+	}
+
+	template<class InputIterator1, class InputIterator2> bool							equal_dispatch(InputIterator1 first1, InputIterator1 last1, InputIterator2 first2, integral_constant<int, COMPARE_GENERIC>)
 	{
 		while (first1 != last1)
 		{
@@ -67,6 +224,28 @@ namespace ft
 		return true;
 	}
 
+	template<class Iterator1, class Iterator2> bool										equal_dispatch(Iterator1 first1, Iterator1 last1, Iterator2 first2, integral_constant<int, COMPARE_MEMCMP>)
+	{
+		size_t	n = last1 - first1;
+		if (!n)
+			return (true);
+		return (!std::memcmp(&*first1, &*first2, n * sizeof(*first1)));
+	}
+
+	template<class Iterator1, class Iterator2> bool										equal_dispatch(Iterator1 first1, Iterator1 last1, Iterator2 first2, integral_constant<int, COMPARE_KERNEL>)
+	{
+		typedef typename contiguous_iterator<Iterator1>::value_type	T;
+		size_t	n = last1 - first1;
+		if (!n)
+			return (true);
+		return (mismatch_index<differ<T> >(&*first1, &*first2, n) == n);
+	}
+
+	template<class InputIterator1, class InputIterator2> bool							equal(InputIterator1 first1, InputIterator1 last1, InputIterator2 first2)
+	{
+		return (equal_dispatch(first1, last1, first2, integral_constant<int, compare_dispatch<InputIterator1, InputIterator2>::equal>()));
+	}
+
 	template<class InputIterator1, class InputIterator2, class BinaryPredicate> bool	equal (InputIterator1 first1, InputIterator1 last1, InputIterator2 first2, BinaryPredicate pred)
 	{
 		while (first1 != last1)
@@ -79,7 +258,7 @@ namespace ft
 		return true;
 	}
 
-	template<class InputIterator1, class InputIterator2> bool							lexicographical_compare (InputIterator1 first1, InputIterator1 last1, InputIterator2 first2, InputIterator2 last2)
+	template<class InputIterator1, class InputIterator2> bool							lexicographical_compare_dispatch(InputIterator1 first1, InputIterator1 last1, InputIterator2 first2, InputIterator2 last2, integral_constant<int, COMPARE_GENERIC>)
 	{
 		while (first1 != last1)
 		{
@@ -93,6 +272,38 @@ namespace ft
 		return (first2 != last2);
 	}
 
+	template<class Iterator1, class Iterator2> bool										lexicographical_compare_dispatch(Iterator1 first1, Iterator1 last1, Iterator2 first2, Iterator2 last2, integral_constant<int, COMPARE_MEMCMP>)
+	{
+		size_t	n1 = last1 - first1;
+		size_t	n2 = last2 - first2;
+		size_t	n = n1 < n2 ? n1 : n2;
+		int		r = n ? std::memcmp(&*first1, &*first2, n) : 0;
+		return (r ? r < 0 : n1 < n2);
+	}
+
+	template<class Iterator1, class Iterator2> bool										lexicographical_compare_dispatch(Iterator1 first1, Iterator1 last1, Iterator2 first2, Iterator2 last2, integral_constant<int, COMPARE_KERNEL>)
+	{
+		typedef typename contiguous_iterator<Iterator1>::value_type	T;
+		size_t	n1 = last1 - first1;
+		size_t	n2 = last2 - first2;
+		size_t	n = n1 < n2 ? n1 : n2;
+		if (!n)
+			return (n1 < n2);
+		const T*	a = &*first1;
+		const T*	b = &*first2;
+		size_t		i = mismatch_index<ordered_apart<T> >(a, b, n);
+		return (i < n ? a[i] < b[i] : n1 < n2);
+	}
+
+	/*
+	** Contiguous ranges of arithmetic types are compared with memcmp or the
+	** mismatch kernel instead of one element at a time.
+	*/
+	template<class InputIterator1, class InputIterator2> bool							lexicographical_compare (InputIterator1 first1, InputIterator1 last1, InputIterator2 first2, InputIterator2 last2)
+	{
+		return (lexicographical_compare_dispatch(first1, last1, first2, last2, integral_constant<int, compare_dispatch<InputIterator1, InputIterator2>::less>()));
+	}
+
 	template<class InputIterator1, class InputIterator2, class Compare> bool			lexicographical_compare (InputIterator1 first1, InputIterator1 last1, InputIterator2 first2, InputIterator2 last2, Compare comp)
 	{
 		while (first1 != last1)
@@ -128,6 +339,11 @@ namespace ft
 				second()
 			{}
 
+			pair(const pair& pr) :
+				first(pr.first),
+				second(pr.second)
+			{}
+
 			template<class U, class V>			pair(const pair<U,V>& pr) :
 				first(pr.first),
 				second(pr.second)
@@ -144,6 +360,33 @@ namespace ft
 				second = pr.second;
 				return (*this);
 			}
+# if __cplusplus >= 201103L
+
+			pair(pair&& pr) :
+				first(std::forward<T1>(pr.first)),
+				second(std::forward<T2>(pr.second))
+			{}
+
+			template<class U, class V>			pair(pair<U,V>&& pr) :
+				first(std::forward<U>(pr.first)),
+				second(std::forward<V>(pr.second))
+			{}
+
+			/*only for arguments convertible to the members*/
+			template<class U, class V, class = typename enable_if<std::is_convertible<U, T1>::value
+				&& std::is_convertible<V, T2>::value>::type>
+												pair(U&& a, V&& b) :
+				first(std::forward<U>(a)),
+				second(std::forward<V>(b))
+			{}
+
+			pair&								operator=(pair&& pr)
+			{
+				first = std::forward<T1>(pr.first);
+				second = std::forward<T2>(pr.second);
+				return (*this);
+			}
+# endif
 	};
 	/*NON-MEMBER FUNCTION OVERLOADS*/
 	template<class T1, class T2> bool			operator==(const pair<T1, T2>& lhs, const pair<T1, T2>& rhs)
@@ -181,6 +424,35 @@ namespace ft
 		return (pair<T1, T2>(x, y));
 	}
 
+	/******************/
+	/* ALIGNED BUFFER */
+	/******************/
+
+	/*
+	** Raw, suitably aligned storage for N objects of type T. Nothing is
+	** constructed: the owner placement-constructs and destroys the elements.
+	*/
+	template<typename T, size_t N> struct		aligned_buffer
+	{
+		union
+		{
+			char		data[sizeof(T) * N];
+			long double	align_ld;
+			long		align_l;
+			void*		align_p;
+		}				_u;
+
+		T*				get()
+		{
+			return (reinterpret_cast<T*>(_u.data));
+		}
+
+		const T*		get() const
+		{
+			return (reinterpret_cast<const T*>(_u.data));
+		}
+	};
+
 	/******************************************************/
 	/* _____ _____ ____ ____   ___  _____  ___  ____   _, */
 	/*   |     |   |    |   \ |   |   |   |   | |   \ |   */
@@ -223,6 +495,386 @@ namespace ft
 			typedef std::random_access_iterator_tag			iterator_category;
 	};
 
+	/************/
+	/* DISTANCE */
+	/************/
+
+	template<class InputIterator> typename iterator_traits<InputIterator>::difference_type	distance(InputIterator first, InputIterator last, std::input_iterator_tag)
+	{
+		typename iterator_traits<InputIterator>::difference_type	n = 0;
+		for (; first != last; ++first)
+			n++;
+		return (n);
+	}
+
+	template<class InputIterator> typename iterator_traits<InputIterator>::difference_type	distance(InputIterator first, InputIterator last, std::random_access_iterator_tag)
+	{
+		return (last - first);
+	}
+
+	template<class InputIterator> typename iterator_traits<InputIterator>::difference_type	distance(InputIterator first, InputIterator last)
+	{
+		return (ft::distance(first, last, typename iterator_traits<InputIterator>::iterator_category()));
+	}
+
+	/***************************/
+	/* FIND, COUNT & MIN / MAX */
+	/***************************/
+
+	template<class T> struct					is_byte : public integral_constant<bool, sizeof(T) == 1> {};
+	template<> struct							is_byte<void> : public integral_constant<bool, false> {};
+
+	/*
+	** How a search over It for a value of type V runs: element by element,
+	** with memchr over bytes, or with the block kernels below. Both sides
+	** must be integral, or the same arithmetic type. An integral value is
+	** converted to the element type first; if it does not survive the round
+	** trip, no element can compare equal to it. The min / max kernels only
+	** take integers, because NaN breaks their "find the value, then its
+	** position" split.
+	*/
+	enum										search_kind
+	{
+		SEARCH_GENERIC,
+		SEARCH_MEMCHR,
+		SEARCH_KERNEL
+	};
+
+	template<class It, class V> struct			search_dispatch
+	{
+		typedef typename contiguous_iterator<It>::value_type	T;
+		static const bool	integral = contiguous_iterator<It>::value && is_integral<T>::value;
+		static const bool	arithmetic = integral || (contiguous_iterator<It>::value && is_floating_point<T>::value);
+		static const int	value = !arithmetic ? SEARCH_GENERIC : (integral && is_integral<V>::value) ? (is_byte<T>::value ? SEARCH_MEMCHR : SEARCH_KERNEL)
+			: is_same<T, V>::value ? SEARCH_KERNEL : SEARCH_GENERIC;
+		static const int	extremum = integral ? SEARCH_KERNEL : SEARCH_GENERIC;
+	};
+
+	/*element test used by the find kernel*/
+	template<class T> struct					equal_value
+	{
+		T	v;
+
+		explicit equal_value(T x) : v(x) {}
+
+		bool	operator()(const T& x) const
+		{
+			return (x == v);
+		}
+	};
+
+	/*
+	** Predicates known to be cheap and free of side effects, the only ones
+	** find_if_index may apply past the first match. User predicates are
+	** never assumed to be.
+	*/
+	template<class Predicate> struct			speculative_predicate : public integral_constant<bool, false> {};
+	template<class T> struct					speculative_predicate<equal_value<T> > : public integral_constant<bool, true> {};
+
+	/*
+	** First index below n whose element satisfies pred, n if none. Same
+	** block scheme as mismatch_index: blocks of 16 are tested without
+	** branching, then only the block holding the hit is rescanned.
+	*/
+	template<class T, class Predicate> size_t	find_if_index(T* a, size_t n, Predicate pred)
+	{
+		size_t	i = 0;
+		for (; i + 16 <= n; i += 16)
+		{
+			int	d = 0;
+			for (size_t j = 0; j < 16; j++)
+				d |= static_cast<bool>(pred(a[i + j]));
+			if (d)
+				break ;
+		}
+		for (; i < n; i++)
+			if (pred(a[i]))
+				return (i);
+		return (n);
+	}
+
+	template<class T> size_t					find_index(const T* a, size_t n, T v)
+	{
+		return (find_if_index(a, n, equal_value<T>(v)));
+	}
+
+	/*last index below n holding v, n if none*/
+	template<class T> size_t					rfind_index(const T* a, size_t n, T v)
+	{
+		size_t	i = n;
+		for (; i >= 16; i -= 16)
+		{
+			int	d = 0;
+			for (size_t j = 0; j < 16; j++)
+				d |= (a[i - 16 + j] == v);
+			if (d)
+				break ;
+		}
+		while (i--)
+			if (a[i] == v)
+				return (i);
+		return (n);
+	}
+
+	template<class T> size_t					count_index(const T* a, size_t n, T v)
+	{
+		size_t	c = 0;
+		size_t	i = 0;
+		for (; i + 16 <= n; i += 16)
+		{
+			unsigned	b = 0;
+			for (size_t j = 0; j < 16; j++)
+				b += (a[i + j] == v);
+			c += b;
+		}
+		for (; i < n; i++)
+			c += (a[i] == v);
+		return (c);
+	}
+
+	/*smallest and largest of a[0, n), n > 0, kept in 16 lanes*/
+	template<class T> void						extremes(const T* a, size_t n, T& lo, T& hi)
+	{
+		size_t	i = 0;
+		lo = a[0];
+		hi = a[0];
+		if (n >= 16)
+		{
+			T	mn[16];
+			T	mx[16];
+			for (size_t j = 0; j < 16; j++)
+			{
+				mn[j] = a[j];
+				mx[j] = a[j];
+			}
+			for (i = 16; i + 16 <= n; i += 16)
+			{
+				for (size_t j = 0; j < 16; j++)
+				{
+					mn[j] = a[i + j] < mn[j] ? a[i + j] : mn[j];
+					mx[j] = mx[j] < a[i + j] ? a[i + j] : mx[j];
+				}
+			}
+			for (size_t j = 0; j < 16; j++)
+			{
+				lo = mn[j] < lo ? mn[j] : lo;
+				hi = hi < mx[j] ? mx[j] : hi;
+			}
+		}
+		for (; i < n; i++)
+		{
+			lo = a[i] < lo ? a[i] : lo;
+			hi = hi < a[i] ? a[i] : hi;
+		}
+	}
+
+	template<class InputIterator, class T> InputIterator							find_dispatch(InputIterator first, InputIterator last, const T& val, integral_constant<int, SEARCH_GENERIC>)
+	{
+		for (; first != last; ++first)
+			if (*first == val)
+				return (first);
+		return (last);
+	}
+
+	template<class Iterator, class T> Iterator										find_dispatch(Iterator first, Iterator last, const T& val, integral_constant<int, SEARCH_MEMCHR>)
+	{
+		typedef typename contiguous_iterator<Iterator>::value_type	E;
+		E			v = static_cast<E>(val);
+		size_t		n = last - first;
+		if (!n || static_cast<T>(v) != val)
+			return (last);
+		const void*	p = std::memchr(&*first, static_cast<unsigned char>(v), n);
+		if (!p)
+			return (last);
+		return (first + (static_cast<const E*>(p) - &*first));
+	}
+
+	template<class Iterator, class T> Iterator										find_dispatch(Iterator first, Iterator last, const T& val, integral_constant<int, SEARCH_KERNEL>)
+	{
+		typedef typename contiguous_iterator<Iterator>::value_type	E;
+		E			v = static_cast<E>(val);
+		size_t		n = last - first;
+		if (!n || static_cast<T>(v) != val)
+			return (last);
+		return (first + find_index<E>(&*first, n, v));
+	}
+
+	/*
+	** Contiguous ranges of arithmetic types are searched with memchr or the
+	** block kernels instead of one element at a time.
+	*/
+	template<class InputIterator, class T> InputIterator							find(InputIterator first, InputIterator last, const T& val)
+	{
+		return (find_dispatch(first, last, val, integral_constant<int, search_dispatch<InputIterator, T>::value>()));
+	}
+
+	template<class InputIterator, class Predicate> InputIterator					find_if_dispatch(InputIterator first, InputIterator last, Predicate pred, integral_constant<int, SEARCH_GENERIC>)
+	{
+		for (; first != last; ++first)
+			if (pred(*first))
+				return (first);
+		return (last);
+	}
+
+	template<class Iterator, class Predicate> Iterator								find_if_dispatch(Iterator first, Iterator last, Predicate pred, integral_constant<int, SEARCH_KERNEL>)
+	{
+		size_t	n = last - first;
+		if (!n)
+			return (last);
+		return (first + find_if_index(&*first, n, pred));
+	}
+
+	/*
+	** pred is applied in order and never past the first match; only the
+	** internal speculative_predicate functors take the block kernel.
+	*/
+	template<class InputIterator, class Predicate> InputIterator					find_if(InputIterator first, InputIterator last, Predicate pred)
+	{
+		return (find_if_dispatch(first, last, pred, integral_constant<int,
+			search_dispatch<InputIterator, void>::arithmetic && speculative_predicate<Predicate>::value ? SEARCH_KERNEL : SEARCH_GENERIC>()));
+	}
+
+	template<class InputIterator, class T> typename iterator_traits<InputIterator>::difference_type	count_dispatch(InputIterator first, InputIterator last, const T& val, integral_constant<int, SEARCH_GENERIC>)
+	{
+		typename iterator_traits<InputIterator>::difference_type	n = 0;
+		for (; first != last; ++first)
+			if (*first == val)
+				n++;
+		return (n);
+	}
+
+	template<class Iterator, class T, int Kind> typename iterator_traits<Iterator>::difference_type	count_dispatch(Iterator first, Iterator last, const T& val, integral_constant<int, Kind>)
+	{
+		typedef typename contiguous_iterator<Iterator>::value_type	E;
+		E			v = static_cast<E>(val);
+		size_t		n = last - first;
+		if (!n || static_cast<T>(v) != val)
+			return (0);
+		return (count_index<E>(&*first, n, v));
+	}
+
+	template<class InputIterator, class T> typename iterator_traits<InputIterator>::difference_type	count(InputIterator first, InputIterator last, const T& val)
+	{
+		return (count_dispatch(first, last, val, integral_constant<int, search_dispatch<InputIterator, T>::value>()));
+	}
+
+	template<class ForwardIterator, class Compare> ForwardIterator					min_element(ForwardIterator first, ForwardIterator last, Compare comp)
+	{
+		ForwardIterator	lo = first;
+		if (first == last)
+			return (last);
+		while (++first != last)
+			if (comp(*first, *lo))
+				lo = first;
+		return (lo);
+	}
+
+	template<class ForwardIterator, class Compare> ForwardIterator					max_element(ForwardIterator first, ForwardIterator last, Compare comp)
+	{
+		ForwardIterator	hi = first;
+		if (first == last)
+			return (last);
+		while (++first != last)
+			if (comp(*hi, *first))
+				hi = first;
+		return (hi);
+	}
+
+	/*first smallest and last largest element, like std::minmax_element*/
+	template<class ForwardIterator, class Compare> pair<ForwardIterator, ForwardIterator>	minmax_element(ForwardIterator first, ForwardIterator last, Compare comp)
+	{
+		ForwardIterator	lo = first;
+		ForwardIterator	hi = first;
+		if (first == last)
+			return (pair<ForwardIterator, ForwardIterator>(lo, hi));
+		while (++first != last)
+		{
+			if (comp(*first, *lo))
+				lo = first;
+			if (!comp(*first, *hi))
+				hi = first;
+		}
+		return (pair<ForwardIterator, ForwardIterator>(lo, hi));
+	}
+
+	template<class ForwardIterator> struct										iterator_less
+	{
+		bool	operator()(const typename iterator_traits<ForwardIterator>::value_type& a, const typename iterator_traits<ForwardIterator>::value_type& b) const
+		{
+			return (a < b);
+		}
+	};
+
+	template<class ForwardIterator> ForwardIterator									min_element_dispatch(ForwardIterator first, ForwardIterator last, integral_constant<int, SEARCH_GENERIC>)
+	{
+		return (ft::min_element(first, last, iterator_less<ForwardIterator>()));
+	}
+
+	template<class Iterator> Iterator												min_element_dispatch(Iterator first, Iterator last, integral_constant<int, SEARCH_KERNEL>)
+	{
+		typedef typename contiguous_iterator<Iterator>::value_type	E;
+		size_t	n = last - first;
+		E		lo;
+		E		hi;
+		if (!n)
+			return (last);
+		extremes(&*first, n, lo, hi);
+		return (first + find_index<E>(&*first, n, lo));
+	}
+
+	template<class ForwardIterator> ForwardIterator									max_element_dispatch(ForwardIterator first, ForwardIterator last, integral_constant<int, SEARCH_GENERIC>)
+	{
+		return (ft::max_element(first, last, iterator_less<ForwardIterator>()));
+	}
+
+	template<class Iterator> Iterator												max_element_dispatch(Iterator first, Iterator last, integral_constant<int, SEARCH_KERNEL>)
+	{
+		typedef typename contiguous_iterator<Iterator>::value_type	E;
+		size_t	n = last - first;
+		E		lo;
+		E		hi;
+		if (!n)
+			return (last);
+		extremes(&*first, n, lo, hi);
+		return (first + find_index<E>(&*first, n, hi));
+	}
+
+	template<class ForwardIterator> pair<ForwardIterator, ForwardIterator>			minmax_element_dispatch(ForwardIterator first, ForwardIterator last, integral_constant<int, SEARCH_GENERIC>)
+	{
+		return (ft::minmax_element(first, last, iterator_less<ForwardIterator>()));
+	}
+
+	template<class Iterator> pair<Iterator, Iterator>								minmax_element_dispatch(Iterator first, Iterator last, integral_constant<int, SEARCH_KERNEL>)
+	{
+		typedef typename contiguous_iterator<Iterator>::value_type	E;
+		size_t	n = last - first;
+		E		lo;
+		E		hi;
+		if (!n)
+			return (pair<Iterator, Iterator>(first, first));
+		extremes(&*first, n, lo, hi);
+		return (pair<Iterator, Iterator>(first + find_index<E>(&*first, n, lo), first + rfind_index<E>(&*first, n, hi)));
+	}
+
+	/*
+	** Contiguous integer ranges find the extreme values with the 16-lane
+	** kernel first, then locate them with find_index / rfind_index.
+	*/
+	template<class ForwardIterator> ForwardIterator									min_element(ForwardIterator first, ForwardIterator last)
+	{
+		return (min_element_dispatch(first, last, integral_constant<int, search_dispatch<ForwardIterator, void>::extremum>()));
+	}
+
+	template<class ForwardIterator> ForwardIterator									max_element(ForwardIterator first, ForwardIterator last)
+	{
+		return (max_element_dispatch(first, last, integral_constant<int, search_dispatch<ForwardIterator, void>::extremum>()));
+	}
+
+	template<class ForwardIterator> pair<ForwardIterator, ForwardIterator>			minmax_element(ForwardIterator first, ForwardIterator last)
+	{
+		return (minmax_element_dispatch(first, last, integral_constant<int, search_dispatch<ForwardIterator, void>::extremum>()));
+	}
+
 	/**************************/
 	/* RANDOM ACCESS ITERATOR */
 	/**************************/
@@ -412,6 +1064,11 @@ namespace ft
 		return (lhs.base() - rhs.base());
 	}
 
+	template<class T> struct					contiguous_iterator<vector_iterator<T> > : public integral_constant<bool, true>
+	{
+		typedef typename remove_const<T>::type	value_type;
+	};
+
 	/********************/
 	/* REVERSE ITERATOR */
 	/********************/
@@ -596,15 +1253,227 @@ namespace ft
 	/*  |   | |   | |          ,_|   |   |___| |    |     */
 	/******************************************************/
 
+	/**********************/
+	/* BINARY SEARCH TREE */
+	/**********************/
+
+	/*
+	** Links shared by every node. The map keeps one of these as a header
+	** sentinel whose left child is the root: it is end(), the successor of the
+	** largest node and the node whose predecessor is the largest node.
+	*/
+	struct							bst_node
+	{
+		bst_node*	left;
+		bst_node*	right;
+		bst_node*	parent;
+		bst_node(bst_node* lft = NULL, bst_node* rit = NULL, bst_node* par = NULL) :
+			left(lft),
+			right(rit),
+			parent(par)
+		{}
+	};
+
+	template<typename T> struct		bst : public bst_node
+	{
+		T			val;
+		bst(const T& v, bst_node* lft = NULL, bst_node* rit = NULL, bst_node* par = NULL) :
+			bst_node(lft, rit, par),
+			val(v)
+		{}
+# if __cplusplus >= 201103L
+
+		bst(T&& v, bst_node* lft = NULL, bst_node* rit = NULL, bst_node* par = NULL) :
+			bst_node(lft, rit, par),
+			val(std::move(v))
+		{}
+# endif
+
+		T&			value()
+		{
+			return (val);
+		}
+	};
+
+	/*
+	** Key/value separated node: the key is kept next to the links so searches
+	** only touch hot bytes, the value lives in a slab_pool owned by the map.
+	*/
+	template<typename T> struct		bst_split : public bst_node
+	{
+		typename T::first_type	key;
+		T*						ref;
+		bst_split(T* r, bst_node* lft = NULL, bst_node* rit = NULL, bst_node* par = NULL) :
+			bst_node(lft, rit, par),
+			key(r->first),
+			ref(r)
+		{}
+
+		T&						value()
+		{
+			return (*ref);
+		}
+	};
+
+	template<typename T, bool Split> struct	bst_select
+	{
+		typedef bst<T>			type;
+	};
+
+	template<typename T> struct		bst_select<T, true>
+	{
+		typedef bst_split<T>	type;
+	};
+
+	template<typename T> const typename T::first_type&	bst_key(bst<T>* bst)
+	{
+		return (bst->val.first);
+	}
+
+	template<typename T> const typename T::first_type&	bst_key(bst_split<T>* bst)
+	{
+		return (bst->key);
+	}
+
+	inline bst_node*				smallest_leaf(bst_node* bst)
+	{
+		while (bst && bst->left)
+			bst = bst->left;
+		return (bst);
+	}
+
+	inline bst_node*				largest_leaf(bst_node* bst)
+	{
+		while (bst && bst->right)
+			bst = bst->right;
+		return (bst);
+	}
+
+	inline bst_node*				bst_next(bst_node* bst)
+	{
+		if (bst->right)
+			return (smallest_leaf(bst->right));
+		bst_node*	t = bst->parent;
+		while (t && bst == t->right)
+		{
+			bst = t;
+			t = t->parent;
+		}
+		return (t);
+	}
+
+	inline bst_node*				bst_prev(bst_node* bst)
+	{
+		if (bst->left)
+			return (largest_leaf(bst->left));
+		bst_node*	t = bst->parent;
+		while (t && bst == t->left)
+		{
+			bst = t;
+			t = t->parent;
+		}
+		return (t);
+	}
+
+	/*************/
+	/* SLAB POOL */
+	/*************/
+
+	/*
+	** Fixed-size object pool carving T-sized slots out of slabs of Slab slots.
+	** Freed slots go on an intrusive free list and slabs are only returned to
+	** the allocator by release(). Slabs come from Alloc rebound to the slot
+	** type, so a stateful allocator travels with the pool through swap().
+	*/
+	template<typename T, typename Alloc, size_t Slab = 64> class	slab_pool
+	{
+		private:
+			union											slot
+			{
+				slot*		next;
+				char		data[sizeof(T)];
+				long double	align_ld;
+				long		align_l;
+				void*		align_p;
+			};
+			typedef typename Alloc::template rebind<slot>::other	slot_allocator;
+
+			/*variables*/
+			slot_allocator	_allocator;
+			slot*			_free;
+			slot*			_slabs;
+
+			slab_pool(const slab_pool&);
+			slab_pool&		operator=(const slab_pool&);
+
+		public:
+			explicit		slab_pool(const Alloc& alloc = Alloc()) :
+				_allocator(alloc),
+				_free(NULL),
+				_slabs(NULL)
+			{}
+
+			~slab_pool()
+			{
+				release();
+			}
+
+			T*				allocate()
+			{
+				if (!_free)
+				{
+					slot*	s = _allocator.allocate(Slab + 1);
+					s->next = _slabs;
+					_slabs = s;
+					for (size_t i = Slab; i > 0; i--)
+					{
+						s[i].next = _free;
+						_free = s + i;
+					}
+				}
+				slot*	s = _free;
+				_free = s->next;
+				return (reinterpret_cast<T*>(s->data));
+			}
+
+			void			deallocate(T* p)
+			{
+				slot*	s = reinterpret_cast<slot*>(p);
+				s->next = _free;
+				_free = s;
+			}
+
+			void			release()
+			{
+				while (_slabs)
+				{
+					slot*	s = _slabs;
+					_slabs = s->next;
+					_allocator.deallocate(s, Slab + 1);
+				}
+				_free = NULL;
+			}
+
+			void			swap(slab_pool& x)
+			{
+				slot_allocator	a = x._allocator;
+				slot*			f = x._free;
+				slot*			s = x._slabs;
+				x._allocator = _allocator;
+				x._free = _free;
+				x._slabs = _slabs;
+				_allocator = a;
+				_free = f;
+				_slabs = s;
+			}
+	};
+
 	/**************************/
 	/* BIDIRECTIONAL ITERATOR */
 	/**************************/
 
 	template<typename T, typename BST> class			map_iterator : public std::iterator<std::bidirectional_iterator_tag, T>
 	{
-		private:
-			bool	_dir;
-
 		public:
 			/*MEMBER TYPES*/
 			typedef typename std::iterator<std::bidirectional_iterator_tag, T>::iterator_category	iterator_category;
@@ -612,49 +1481,35 @@ namespace ft
 			typedef typename std::iterator<std::bidirectional_iterator_tag, T>::difference_type		difference_type;
 			typedef T*																				pointer;
 			typedef T&																				reference;
-			typedef BST*																			bst;
+			typedef bst_node*																		node_pointer;
 
+		private:
 			/*variables*/
-			bst	_bst;
-			bst	_root;
+			node_pointer	_node;
 
+		public:
 			/*MEMBER FUNCTIONS*/
 			map_iterator() :
-				_dir(false),
-				_bst(NULL),
-				_root(NULL)
+				_node(NULL)
 			{}
 
-			map_iterator(bst b, bst r, bool d = 0)
-			{
-				_bst = b;
-				_root = r;
-				_dir = d;
-			}
-
-			map_iterator(const map_iterator& map_it)
-			{
-				*this = map_it;
-			}
+			map_iterator(node_pointer n) :
+				_node(n)
+			{}
 
-			map_iterator&					operator=(const map_iterator& map_it)
+			node_pointer					node() const
 			{
-				_bst = map_it._bst;
-				_root = map_it._root;
-				_dir = map_it._dir;
-				return (*this);
+				return (_node);
 			}
 
-			virtual ~map_iterator() {}
-
 			pointer							base() const
 			{
-				return (_bst);
+				return (&(operator*()));
 			}
 
 			reference						operator*() const
 			{
-				return (_bst->val);
+				return (static_cast<BST*>(_node)->value());
 			}
 
 			pointer							operator->() const
@@ -664,24 +1519,7 @@ namespace ft
 
 			map_iterator&					operator++()
 			{
-				if (!_bst && _dir)
-					_bst = smallest_leaf(_root);
-				else if (!_bst)
-					return (*this);
-				else if (_bst == largest_leaf(_root) && !_dir)
-					_bst = NULL;
-				else if (_bst->right)
-					_bst = smallest_leaf(_bst->right);
-				else
-				{
-					bst	t = _bst->parent;
-					while (t && _bst == t->right)
-					{
-						_bst = t;
-						t = t->parent;
-					}
-					_bst = t;
-				}
+				_node = bst_next(_node);
 				return (*this);
 			}
 
@@ -694,24 +1532,7 @@ namespace ft
 
 			map_iterator&					operator--()
 			{
-				if (!_bst && !_dir)
-					_bst = largest_leaf(_root);
-				else if (!_bst)
-					return (*this);
-				else if (_bst == smallest_leaf(_root) && _dir)
-					_bst = NULL;
-				else if (_bst->left)
-					_bst = largest_leaf(_bst->left);
-				else
-				{
-					bst	t = _bst->parent;
-					while (t && _bst == t->left)
-					{
-						_bst = t;
-						t = t->parent;
-					}
-					_bst = t;
-				}
+				_node = bst_prev(_node);
 				return (*this);
 			}
 
@@ -724,57 +1545,19 @@ namespace ft
 
 			operator map_iterator<const T, BST>() const
 			{
-				return map_iterator<const T, BST>(_bst, _root);
+				return map_iterator<const T, BST>(_node);
 			}
 
-			template<typename X> bool						operator==(const ft::map_iterator<X, BST>& x)
+			template<typename X> bool		operator==(const ft::map_iterator<X, BST>& x) const
 			{
-				return (_bst == x._bst);
+				return (_node == x.node());
 			}
 
-			template<typename X> bool						operator!=(const ft::map_iterator<X, BST>& x)
+			template<typename X> bool		operator!=(const ft::map_iterator<X, BST>& x) const
 			{
-				return (_bst != x._bst);
+				return (_node != x.node());
 			}
 	};
-
-	/**********************/
-	/* BINARY SEARCH TREE */
-	/**********************/
-
-	template<typename T> struct		bst
-	{
-		T			val;
-		struct bst*	left;
-		struct bst*	right;
-		struct bst* parent;
-		bst() :
-			left(NULL),
-			right(NULL),
-			parent(NULL)
-		{}
-
-		bst(T v, struct bst* lft = NULL, struct bst* rit = NULL, struct bst* par = NULL) :
-			val(v),
-			left(lft),
-			right(rit),
-			parent(par)
-		{}
-	};
-
-	template<typename T> bst<T>*	smallest_leaf(bst<T> *bst)
-	{
-		if (!bst || !bst->left)
-			return bst;
-		return smallest_leaf(bst->left);
-	}
-
-	template<typename T> bst<T>*	largest_leaf(bst<T> *bst)
-	{
-		if (!bst || !bst->right)
-			return bst;
-		return largest_leaf(bst->right);
-	}
 }
 
 #endif
@@ -1,14 +1,236 @@
 #ifndef VECTOR_HPP
 # define VECTOR_HPP
 
+# include <cstring>
 # include <memory>
 # include <iterator>
 # include <stdexcept>
 # include "utils.hpp"
+# include "allocator.hpp"
+
+/*
+** Capacity multiplier applied when push_back/insert run out of room.
+** Any value > 1 works, e.g. -DFT_VECTOR_GROWTH=1.5.
+*/
+# ifndef FT_VECTOR_GROWTH
+#  define FT_VECTOR_GROWTH 2
+# endif
+
+/*
+** Relocation moves elements when T's move constructor cannot throw (C++11
+** builds) and copies them otherwise.
+*/
+# if __cplusplus >= 201103L
+#  include <utility>
+#  define FT_MOVE_IF_NOEXCEPT(x) std::move_if_noexcept(x)
+# else
+#  define FT_MOVE_IF_NOEXCEPT(x) (x)
+# endif
 
 namespace ft
 {
-	template<class T, class Alloc = std::allocator<T> > class	vector
+	/*
+	** Storage and element helpers shared by vector and small_vector. The
+	** _make_gap/_fill_gap/_copy_gap trio opens uninitialized slots and fills
+	** them, closing the gap again if a copy throws so _end never covers
+	** unconstructed slots.
+	*/
+	template<class T, class Alloc> class	vector_base
+	{
+		protected:
+			/*MEMBER TYPES*/
+			typedef T											value_type;
+			typedef Alloc										allocator_type;
+			typedef typename allocator_type::pointer			pointer;
+			typedef typename allocator_type::const_pointer		const_pointer;
+			typedef typename allocator_type::size_type			size_type;
+			/*elements may be moved with memmove/memcpy*/
+			typedef integral_constant<bool, is_trivially_copyable<value_type>::value
+				&& has_plain_construct<allocator_type>::value>					trivial_tag;
+
+			/*variables*/
+			allocator_type							_allocator;
+			pointer									_begin;
+			pointer									_end;
+			size_type								_capacity;
+
+			/*functions*/
+			explicit								vector_base(const allocator_type& alloc) :
+				_allocator(alloc),
+				_begin(NULL),
+				_end(NULL),
+				_capacity(0)
+			{}
+
+			/*constructs [first, last) at dst and destroys the source, ranges may overlap*/
+			void									_move_range(pointer dst, pointer first, pointer last, integral_constant<bool, true>)
+			{
+				if (first != last)
+					std::memmove(static_cast<void*>(dst), static_cast<const void*>(first), (last - first) * sizeof(value_type));
+			}
+
+			void									_move_range(pointer dst, pointer first, pointer last, integral_constant<bool, false>)
+			{
+				if (dst < first)
+				{
+					for (; first != last; ++first, ++dst)
+					{
+						_allocator.construct(dst, FT_MOVE_IF_NOEXCEPT(*first));
+						_allocator.destroy(first);
+					}
+					return ;
+				}
+				dst += last - first;
+				while (last != first)
+				{
+					--last;
+					--dst;
+					_allocator.construct(dst, FT_MOVE_IF_NOEXCEPT(*last));
+					_allocator.destroy(last);
+				}
+			}
+
+			void									_move_range(pointer dst, pointer first, pointer last)
+			{
+				_move_range(dst, first, last, trivial_tag());
+			}
+
+			/*copy-constructs [first, last) into uninitialized storage at dst*/
+			void									_copy_range(pointer dst, const_pointer first, const_pointer last, integral_constant<bool, true>)
+			{
+				if (first != last)
+					std::memcpy(static_cast<void*>(dst), static_cast<const void*>(first), (last - first) * sizeof(value_type));
+			}
+
+			void									_copy_range(pointer dst, const_pointer first, const_pointer last, integral_constant<bool, false>)
+			{
+				for (; first != last; ++first, ++dst)
+					_allocator.construct(dst, *first);
+			}
+
+			void									_copy_range(pointer dst, const_pointer first, const_pointer last)
+			{
+				_copy_range(dst, first, last, trivial_tag());
+			}
+
+			/*copy-constructs n copies of val into uninitialized storage at dst*/
+			void									_fill_range(pointer dst, size_type n, const value_type& val, integral_constant<bool, true>)
+			{
+				if (!n)
+					return ;
+				if (sizeof(value_type) == 1)
+				{
+					std::memset(static_cast<void*>(dst), *reinterpret_cast<const unsigned char*>(&val), n);
+					return ;
+				}
+				std::memcpy(static_cast<void*>(dst), static_cast<const void*>(&val), sizeof(value_type));
+				for (size_type done = 1; done < n; done *= 2)
+					std::memcpy(static_cast<void*>(dst + done), static_cast<const void*>(dst), (done < n - done ? done : n - done) * sizeof(value_type));
+			}
+
+			/*on a throwing copy, destroys the copies already made and rethrows*/
+			void									_fill_range(pointer dst, size_type n, const value_type& val, integral_constant<bool, false>)
+			{
+				pointer	p = dst;
+				try
+				{
+					for (; n; --n, ++p)
+						_allocator.construct(p, val);
+				}
+				catch (...)
+				{
+					_destroy_range(dst, p);
+					throw;
+				}
+			}
+
+			void									_fill_range(pointer dst, size_type n, const value_type& val)
+			{
+				_fill_range(dst, n, val, trivial_tag());
+			}
+
+			void									_destroy_range(pointer first, pointer last)
+			{
+				if (trivial_tag::value)
+					return ;
+				for (; first != last; ++first)
+					_allocator.destroy(first);
+			}
+
+			size_type								_grow_capacity(size_type n) const
+			{
+				size_type	c = static_cast<size_type>(_capacity * FT_VECTOR_GROWTH);
+				if (n > _allocator.max_size())
+					throw std::length_error("L");
+				if (c < n)
+					c = n;
+				if (c > _allocator.max_size())
+					c = _allocator.max_size();
+				return (c);
+			}
+
+			/*opens n uninitialized slots at index p; owned tells whether the current block is freed when it moves*/
+			pointer									_make_gap(size_type p, size_type n, bool owned)
+			{
+				size_type	s = _end - _begin;
+				if (s + n <= _capacity)
+				{
+					_move_range(_begin + p + n, _begin + p, _end);
+					_end += n;
+					return (_begin + p);
+				}
+				size_type	c = _grow_capacity(s + n);
+				pointer		b = _allocator.allocate(c);
+				_move_range(b, _begin, _begin + p);
+				_move_range(b + p + n, _begin + p, _end);
+				if (owned)
+					_allocator.deallocate(_begin, _capacity);
+				_begin = b;
+				_end = b + s + n;
+				_capacity = c;
+				return (b + p);
+			}
+
+			/*undoes _make_gap after a failed construction: the tail moves back over the n slots at p*/
+			void									_close_gap(pointer p, size_type n)
+			{
+				_move_range(p, p + n, _end);
+				_end -= n;
+			}
+
+			/*fills the gap at p with n copies of val*/
+			void									_fill_gap(pointer p, size_type n, const value_type& val)
+			{
+				try
+				{
+					_fill_range(p, n, val);
+				}
+				catch (...)
+				{
+					_close_gap(p, n);
+					throw;
+				}
+			}
+
+			/*fills the gap at p with the n elements read from first*/
+			template <class ForwardIterator> void	_copy_gap(pointer p, size_type n, ForwardIterator first)
+			{
+				pointer	q = p;
+				try
+				{
+					for (; q != p + n; ++first, ++q)
+						_allocator.construct(q, *first);
+				}
+				catch (...)
+				{
+					_destroy_range(p, q);
+					_close_gap(p, n);
+					throw;
+				}
+			}
+	};
+
+	template<class T, class Alloc = std::allocator<T> > class	vector : private vector_base<T, Alloc>
 	{
 		public:
 			/*MEMBER TYPES*/
@@ -26,38 +248,191 @@ namespace ft
 			typedef typename allocator_type::size_type			size_type;
 
 		private:
+			typedef vector_base<T, Alloc>						_base;
+			typedef typename _base::trivial_tag					trivial_tag;
+			/*growth hands the whole block to the allocator's reallocate*/
+			typedef integral_constant<bool, trivial_tag::value
+				&& can_reallocate<allocator_type>::value>		realloc_tag;
+
 			/*variables*/
-			allocator_type							_allocator;
-			pointer									_begin;
-			pointer									_end;
-			size_type								_capacity;
+			using _base::_allocator;
+			using _base::_begin;
+			using _base::_end;
+			using _base::_capacity;
+
+			/*functions*/
+			using _base::_move_range;
+			using _base::_copy_range;
+			using _base::_fill_range;
+			using _base::_destroy_range;
+			using _base::_grow_capacity;
+			using _base::_close_gap;
+			using _base::_fill_gap;
+			using _base::_copy_gap;
+
+			/*moves the elements into a block of capacity c*/
+			void									_reallocate(size_type c, integral_constant<bool, true>)
+			{
+				size_type	s = size();
+				_begin = _allocator.reallocate(_begin, _capacity, c);
+				_end = _begin + s;
+				_capacity = c;
+			}
+
+			void									_reallocate(size_type c, integral_constant<bool, false>)
+			{
+				pointer		b = _allocator.allocate(c);
+				size_type	s = size();
+				_move_range(b, _begin, _end);
+				if (_begin)
+					_allocator.deallocate(_begin, _capacity);
+				_begin = b;
+				_end = b + s;
+				_capacity = c;
+			}
+
+			void									_reallocate(size_type c)
+			{
+				_reallocate(c, realloc_tag());
+			}
+
+			/*opens n uninitialized slots at index p, reallocating at most once*/
+			pointer									_make_gap(size_type p, size_type n)
+			{
+				if (realloc_tag::value && size() + n > _capacity)
+					_reallocate(_grow_capacity(size() + n));
+				return (_base::_make_gap(p, n, _begin != NULL));
+			}
+
+			template <class InputIterator> void		_range_insert(iterator position, InputIterator first, InputIterator last, std::input_iterator_tag)
+			{
+				size_type	p = &(*position) - _begin;
+				vector		t(_allocator);
+				for (; first != last; ++first)
+					t.push_back(*first);
+				_range_insert(iterator(_begin + p), t.begin(), t.end(), std::random_access_iterator_tag());
+			}
+
+			template <class ForwardIterator> void	_range_insert(iterator position, ForwardIterator first, ForwardIterator last, std::forward_iterator_tag)
+			{
+				size_type	n = ft::distance(first, last);
+				if (!n)
+					return ;
+				_copy_gap(_make_gap(&(*position) - _begin, n), n, first);
+			}
+
+			/*drops every element and the buffer, then allocates room for n*/
+			void									_reset(size_type n)
+			{
+				clear();
+				if (_begin)
+					_allocator.deallocate(_begin, _capacity);
+				_begin = NULL;
+				_end = NULL;
+				_capacity = 0;
+				_begin = _allocator.allocate(n);
+				_end = _begin;
+				_capacity = n;
+			}
+
+			/*
+			** Replaces the contents with n elements read from first: live
+			** elements are copy-assigned, only the difference is constructed or
+			** destroyed, and the buffer is replaced only when n exceeds capacity.
+			*/
+			template <class ForwardIterator> void	_assign_n(ForwardIterator first, size_type n)
+			{
+				if (n > _capacity)
+					_reset(n);
+				pointer	p = _begin;
+				for (; n && p != _end; --n, ++first, ++p)
+					*p = *first;
+				_destroy_range(p, _end);
+				_end = p;
+				for (; n; --n, ++first)
+					_allocator.construct(_end++, *first);
+			}
+
+			template <class InputIterator> void		_assign(InputIterator first, InputIterator last, std::input_iterator_tag)
+			{
+				pointer	p = _begin;
+				for (; first != last && p != _end; ++first, ++p)
+					*p = *first;
+				if (first == last)
+				{
+					_destroy_range(p, _end);
+					_end = p;
+				}
+				for (; first != last; ++first)
+					push_back(*first);
+			}
+
+			template <class ForwardIterator> void	_assign(ForwardIterator first, ForwardIterator last, std::forward_iterator_tag)
+			{
+				_assign_n(first, ft::distance(first, last));
+			}
+
+			/*moves the elements into b (capacity c) whose n slots past them are already built*/
+			void									_adopt(pointer b, size_type c, size_type n)
+			{
+				size_type	s = size();
+				_move_range(b, _begin, _end);
+				if (_begin)
+					_allocator.deallocate(_begin, _capacity);
+				_begin = b;
+				_end = b + s + n;
+				_capacity = c;
+			}
+
+			FT_COLD void							_grow_push_back(const value_type& val)
+			{
+				size_type	c = _grow_capacity(size() + 1);
+				if (realloc_tag::value)
+				{
+					value_type	t(val);
+					_reallocate(c);
+					_allocator.construct(_end++, t);
+					return ;
+				}
+				pointer		b = _allocator.allocate(c);
+				_allocator.construct(b + size(), val);
+				_adopt(b, c, 1);
+			}
+# if __cplusplus >= 201103L
+
+			template <class... Args> FT_COLD void	_grow_emplace_back(Args&&... args)
+			{
+				size_type	c = _grow_capacity(size() + 1);
+				if (realloc_tag::value)
+				{
+					value_type	t(std::forward<Args>(args)...);
+					_reallocate(c);
+					_allocator.construct(_end++, t);
+					return ;
+				}
+				pointer		b = _allocator.allocate(c);
+				_allocator.construct(b + size(), std::forward<Args>(args)...);
+				_adopt(b, c, 1);
+			}
+# endif
+
 		public:
 			/*MEMBER FUNCTIONS*/
 			explicit								vector(const allocator_type& alloc = allocator_type()) :
-				_allocator(alloc),
-				_begin(NULL),
-				_end(NULL),
-				_capacity(0)
+				_base(alloc)
 			{}
 
 			explicit								vector(size_type n, const value_type& val = value_type(), const allocator_type& alloc = allocator_type()) :
-				_allocator(alloc),
-				_begin(NULL),
-				_end(NULL),
-				_capacity(0)
+				_base(alloc)
 			{
 				_begin = _allocator.allocate(n);
-				_end = _begin;
+				_end = _begin + n;
 				_capacity = n;
-				while (n--)
-					_allocator.construct(_end++, val);
+				_fill_range(_begin, n, val);
 			}
 
 			template <class InputIterator>			vector(InputIterator first, InputIterator last, const allocator_type& alloc = allocator_type(), typename ft::enable_if<!is_integral<InputIterator>::value, InputIterator>::type* = NULL) :
-				_allocator(alloc),
-				_begin(NULL),
-				_end(NULL),
-				_capacity(0)
+				_base(alloc)
 			{
 				size_type	i;
 				InputIterator	f(first);
@@ -71,24 +446,49 @@ namespace ft
 			}
 
 			vector(const vector& x) :
-				_allocator(x.get_allocator()),
-				_begin(NULL),
-				_end(NULL),
-				_capacity(0)
+				_base(x.get_allocator())
 			{
 				*this = x;
 			}
 
 			~vector()
 			{
-				clear();
+				_destroy_range(_begin, _end);
 				_allocator.deallocate(_begin, _capacity);
 			}
 
+# if __cplusplus >= 201103L
+			vector(vector&& x) noexcept :
+				_base(x._allocator)
+			{
+				_begin = x._begin;
+				_end = x._end;
+				_capacity = x._capacity;
+				x._begin = NULL;
+				x._end = NULL;
+				x._capacity = 0;
+			}
+
+			vector&									operator=(vector&& x) noexcept
+			{
+				swap(x);
+				return (*this);
+			}
+
+# endif
 			vector&									operator=(const vector& x)
 			{
-				clear();
-				insert(end(), x.begin(), x.end());
+				if (this == &x)
+					return (*this);
+				if (!trivial_tag::value)
+				{
+					_assign_n(x._begin, x.size());
+					return (*this);
+				}
+				if (x.size() > _capacity)
+					_reset(x.size());
+				_copy_range(_begin, x._begin, x._end);
+				_end = _begin + x.size();
 				return (*this);
 			}
 
@@ -151,8 +551,10 @@ namespace ft
 			void									resize(size_type n, value_type val = value_type())
 			{
 				if (n <= size())
-					while (n < size())
-						erase(_begin + n);
+				{
+					_destroy_range(_begin + n, _end);
+					_end = _begin + n;
+				}
 				else
 				{
 					reserve(n);
@@ -161,6 +563,26 @@ namespace ft
 				}
 			}
 
+			/*
+			** resize() without value-initializing the new elements: trivially
+			** constructible ones are left unwritten, so freshly mapped pages
+			** are not touched until the caller fills them.
+			*/
+			void									resize_default_init(size_type n)
+			{
+				if (n <= size())
+				{
+					_destroy_range(_begin + n, _end);
+					_end = _begin + n;
+					return ;
+				}
+				reserve(n);
+				if (is_trivially_default_constructible<value_type>::value && has_plain_construct<allocator_type>::value)
+					_end = _begin + n;
+				while (size() < n)
+					_allocator.construct(_end++, value_type());
+			}
+
 			size_type								capacity() const
 			{
 				return _capacity;
@@ -173,26 +595,56 @@ namespace ft
 				return true;
 			}
 
+			/*
+			** Largest power of two the buffer address is a multiple of, or the
+			** allocator's guarantee while nothing is allocated.
+			*/
+			size_type								alignment() const
+			{
+				size_t	a = reinterpret_cast<size_t>(_begin);
+				if (!_begin)
+					return (allocator_alignment<allocator_type>::value);
+				return (a & (~a + 1));
+			}
+
 			void									reserve(size_type n)
 			{
 				if (n > max_size())
 					throw std::length_error("L");
 				if (n <= _capacity)
 					return ;
-				pointer		t_b = _begin;
-				pointer		t_e = _end;
-				size_type	s = size();
-				size_type	c = capacity();
-				_begin = _allocator.allocate(n);
-				_capacity = n;
-				_end = _begin;
-				while (t_b != t_e)
+				_reallocate(n);
+			}
+
+			/*
+			** Drops the slack capacity. Allocators with reallocate shrink the
+			** block in place (mremap), others get a fresh exact-size copy.
+			*/
+			void									shrink_to_fit()
+			{
+				if (_capacity == size())
+					return ;
+				if (empty())
 				{
-					_allocator.construct(_end, *t_b);
-					_end++;
-					t_b++;
+					_allocator.deallocate(_begin, _capacity);
+					_begin = NULL;
+					_end = NULL;
+					_capacity = 0;
+					return ;
 				}
-				_allocator.deallocate(t_b - s, c);
+				_reallocate(size());
+			}
+
+			/*bytes held by the vector itself: the object plus its whole buffer*/
+			size_type								memory_usage() const
+			{
+				return (sizeof(*this) + _capacity * sizeof(value_type));
+			}
+
+			/*bytes of buffer past the last element*/
+			size_type								wasted_bytes() const
+			{
+				return ((_capacity - size()) * sizeof(value_type));
 			}
 
 			/*element access*/
@@ -243,70 +695,117 @@ namespace ft
 			/*modifiers*/
 			template <class InputIterator> void		assign(InputIterator first, InputIterator last, typename ft::enable_if<!is_integral<InputIterator>::value, InputIterator>::type* = NULL)
 			{
-				clear();
-				_allocator.deallocate(_begin, _capacity);
-				size_type	i;
-				InputIterator	f(first);
-				InputIterator	l(last);
-				for (i = 0; f++ != l; i++);
-				_begin = _allocator.allocate(i);
-				_end = _begin;
-				_capacity = i;
-				while (first != last)
-					_allocator.construct(_end++, *first++);
+				_assign(first, last, typename ft::iterator_traits<InputIterator>::iterator_category());
 			}
 
 			void									assign(size_type n, const value_type& val)
 			{
-				clear();
-				_allocator.deallocate(_begin, _capacity);
-				_begin = _allocator.allocate(n);
-				_end = _begin;
-				_capacity = n;
-				while (n--)
-					_allocator.construct(_end++, val);
+				value_type	t(val);
+				if (n > _capacity)
+					_reset(n);
+				pointer	p = _begin;
+				for (; n && p != _end; --n, ++p)
+					*p = t;
+				_destroy_range(p, _end);
+				_end = p;
+				_fill_range(_end, n, t);
+				_end += n;
 			}
 
 			void									push_back(const value_type& val)
 			{
-				insert(_end, val);
+				if (_end != _begin + _capacity)
+				{
+					_allocator.construct(_end, val);
+					_end++;
+				}
+				else
+					_grow_push_back(val);
 			}
 
+# if __cplusplus >= 201103L
+			void									push_back(value_type&& val)
+			{
+				emplace_back(std::move(val));
+			}
+
+			template <class... Args> void			emplace_back(Args&&... args)
+			{
+				if (_end != _begin + _capacity)
+				{
+					_allocator.construct(_end, std::forward<Args>(args)...);
+					_end++;
+				}
+				else
+					_grow_emplace_back(std::forward<Args>(args)...);
+			}
+
+			template <class... Args> iterator		emplace(iterator position, Args&&... args)
+			{
+				size_type	p = position.base() - _begin;
+				if (_begin + p == _end)
+				{
+					emplace_back(std::forward<Args>(args)...);
+					return (iterator(_begin + p));
+				}
+				value_type	t(std::forward<Args>(args)...);
+				pointer		g = _make_gap(p, 1);
+				try
+				{
+					_allocator.construct(g, std::move(t));
+				}
+				catch (...)
+				{
+					_close_gap(g, 1);
+					throw;
+				}
+				return (iterator(_begin + p));
+			}
+
+			iterator								insert(iterator position, value_type&& val)
+			{
+				return (emplace(position, std::move(val)));
+			}
+
+# endif
 			void									pop_back()
 			{
-				erase(_end - 1);
+				_end--;
+				_allocator.destroy(_end);
 			}
 
 			iterator								insert(iterator position, const value_type& val)
 			{
 				size_type	p = &(*position) - _begin;
-				if (_capacity >= size() + 1)
+				if (_end != _begin + _capacity && _begin + p == _end)
 				{
-					for (size_type i = 0; i < size() - p; i++)
-						_allocator.construct(_end - i, *(_end - i - 1));
+					_allocator.construct(_end, val);
 					_end++;
-					_allocator.construct(&(*position), val);
+				}
+				else if (_end != _begin + _capacity || realloc_tag::value)
+				{
+					value_type	t(val);
+					_fill_gap(_make_gap(p, 1), 1, t);
 				}
 				else
 				{
-					int		new_capacity;
-					if (size())
-						new_capacity = size() * 2;
-					else
-						new_capacity = 1;
+					size_type	new_capacity = _grow_capacity(size() + 1);
 					pointer		b = _allocator.allocate(new_capacity);
-					pointer		e = b + size() + 1;
-					for (size_type i = 0; i < p; i++)
-						_allocator.construct(b + i, *(_begin + i));
-					_allocator.construct(b + p, val);
-					for (size_type i = 0; i < size() - p; i++)
-						_allocator.construct(e - i - 1, *(_end - i - 1));
-					for (size_type i = 0; i < size(); i++)
-						_allocator.destroy(_begin + i);
+					try
+					{
+						_allocator.construct(b + p, val);
+					}
+					catch (...)
+					{
+						_allocator.deallocate(b, new_capacity);
+						throw;
+					}
+					_move_range(b, _begin, _begin + p);
+					_move_range(b + p + 1, _begin + p, _end);
 					if (_begin)
 						_allocator.deallocate(_begin, _capacity);
+					_end = b + size() + 1;
 					_begin = b;
-					_end = e;
 					_capacity = new_capacity;
 				}
 				return (iterator(_begin + p));
@@ -314,37 +813,35 @@ namespace ft
 
 			void									insert(iterator position, size_type n, const value_type& val)
 			{
-				while (n > 0)
-				{
-					position = insert(position, val);
-					n--;
-				}
+				if (!n)
+					return ;
+				value_type	t(val);
+				_fill_gap(_make_gap(position.base() - _begin, n), n, t);
 			}
 
 			template <class InputIterator> void		insert(iterator position, InputIterator first, InputIterator last, typename ft::enable_if<!is_integral<InputIterator>::value, InputIterator>::type* = NULL)
 			{
-				while (first != last)
-					position = insert(position, *first++) + 1;
+				_range_insert(position, first, last, typename ft::iterator_traits<InputIterator>::iterator_category());
 			}
 
 			iterator								erase(iterator position)
 			{
-				iterator	p(position);
-				_allocator.destroy(&(*position));
-				while (position + 1 != end())
-				{
-					_allocator.construct(&(*position), *(position + 1));
-					position++;
-				}
-				_allocator.destroy(&(*(position)));
+				pointer	p = &(*position);
+				_allocator.destroy(p);
+				_move_range(p, p + 1, _end);
 				_end--;
-				return (p);
+				return (position);
 			}
 
 			iterator								erase(iterator first, iterator last)
 			{
-				while (first != last--)
-					erase(first);
+				pointer	f = first.base();
+				pointer	l = last.base();
+				if (f == l)
+					return (first);
+				_destroy_range(f, l);
+				_move_range(f, l, _end);
+				_end -= l - f;
 				return (first);
 			}
 
@@ -368,7 +865,8 @@ namespace ft
 
 			void									clear()
 			{
-				erase(begin(), end());
+				_destroy_range(_begin, _end);
+				_end = _begin;
 			}
 
 			/*allocator*/